@@ -0,0 +1,80 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/message.hpp>
+#include <fmt/format.h>
+
+#include "fawkes/cookie.hpp"
+
+namespace {
+
+namespace http = boost::beast::http;
+
+http::request_header<> make_header(std::int64_t num_pairs) {
+    std::string value;
+    for (std::int64_t i = 0; i < num_pairs; ++i) {
+        if (!value.empty()) {
+            value += "; ";
+        }
+        value += fmt::format("name{}=value-{}", i, i * 7);
+    }
+
+    http::request_header<> header;
+    header.set(http::field::cookie, value);
+    return header;
+}
+
+// Single-name read through the raw-scan fast path; the wanted pair sits in the middle
+// of the header, so roughly half of it is scanned.
+void bm_cookie_view_get_view(benchmark::State& state) {
+    const auto header = make_header(state.range(0));
+    const auto wanted = fmt::format("name{}", state.range(0) / 2);
+
+    auto [begin, end] = header.equal_range(http::field::cookie);
+    for ([[maybe_unused]] auto iter : state) {
+        const fawkes::cookie_view cv(begin, end);
+        auto value = cv.get_view(wanted);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+// Materializes the full name->value map, i.e. the worst case of the lazy view.
+void bm_cookie_view_full_parse(benchmark::State& state) {
+    const auto header = make_header(state.range(0));
+
+    auto [begin, end] = header.equal_range(http::field::cookie);
+    for ([[maybe_unused]] auto iter : state) {
+        const fawkes::cookie_view cv(begin, end);
+        benchmark::DoNotOptimize(cv.size());
+    }
+}
+
+void bm_cookie_to_string(benchmark::State& state) {
+    using namespace std::chrono_literals;
+
+    fawkes::cookie cookie("session", "a moderately long value with spaces");
+    cookie.path = "/";
+    cookie.domain = "example.com";
+    cookie.max_age = 24h;
+    cookie.http_only = true;
+    cookie.secure = true;
+    cookie.same_site = fawkes::same_site_policy::lax;
+
+    for ([[maybe_unused]] auto iter : state) {
+        auto str = cookie.to_string();
+        benchmark::DoNotOptimize(str);
+    }
+}
+
+BENCHMARK(bm_cookie_view_get_view)->Arg(1)->Arg(10)->Arg(40);
+BENCHMARK(bm_cookie_view_full_parse)->Arg(1)->Arg(10)->Arg(40);
+BENCHMARK(bm_cookie_to_string);
+
+} // namespace
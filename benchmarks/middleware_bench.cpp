@@ -0,0 +1,100 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "fawkes/middleware.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+
+namespace {
+
+namespace asio = boost::asio;
+
+// A middleware of measurable-but-trivial work, so the numbers reflect the chain's
+// dispatch overhead rather than middleware bodies.
+struct counting_middleware {
+    std::uint64_t hits{0};
+
+    fawkes::middleware_result pre_handle(fawkes::request& /*req*/,
+                                         fawkes::response& /*resp*/) {
+        ++hits;
+        return fawkes::middleware_result::proceed;
+    }
+
+    fawkes::middleware_result post_handle(fawkes::request& /*req*/,
+                                          fawkes::response& /*resp*/) {
+        ++hits;
+        return fawkes::middleware_result::proceed;
+    }
+};
+
+struct coro_counting_middleware {
+    std::uint64_t hits{0};
+
+    asio::awaitable<fawkes::middleware_result> pre_handle(fawkes::request& /*req*/,
+                                                          fawkes::response& /*resp*/) {
+        ++hits;
+        co_return fawkes::middleware_result::proceed;
+    }
+};
+
+template<typename Mw, std::size_t... I>
+auto make_tuple_of(std::index_sequence<I...> /*seq*/) {
+    return std::tuple{((void)I, Mw{})...};
+}
+
+// The synchronous fold: plain calls, no coroutine frame.
+template<std::size_t N>
+void bm_chain_sync_pre_handle(benchmark::State& state) {
+    fawkes::middleware_chain chain;
+    chain.set(make_tuple_of<counting_middleware>(std::make_index_sequence<N>{}));
+
+    fawkes::request req;
+    fawkes::response resp;
+    for ([[maybe_unused]] auto iter : state) {
+        auto result = chain.pre_handle_sync(req, resp);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+// The coroutine path, driven by a live io_context: one co_spawn per dispatch, which
+// is what an asynchronous chain costs the server per request.
+template<std::size_t N>
+void bm_chain_coro_pre_handle(benchmark::State& state) {
+    fawkes::middleware_chain chain;
+    chain.set(make_tuple_of<coro_counting_middleware>(std::make_index_sequence<N>{}));
+
+    fawkes::request req;
+    fawkes::response resp;
+    asio::io_context ioc;
+    for ([[maybe_unused]] auto iter : state) {
+        asio::co_spawn(
+            ioc,
+            [&]() -> asio::awaitable<void> {
+                auto result = co_await chain.pre_handle(req, resp);
+                benchmark::DoNotOptimize(result);
+            },
+            asio::detached);
+        ioc.run();
+        ioc.restart();
+    }
+}
+
+BENCHMARK(bm_chain_sync_pre_handle<1>);
+BENCHMARK(bm_chain_sync_pre_handle<4>);
+BENCHMARK(bm_chain_sync_pre_handle<8>);
+BENCHMARK(bm_chain_coro_pre_handle<1>);
+BENCHMARK(bm_chain_coro_pre_handle<4>);
+BENCHMARK(bm_chain_coro_pre_handle<8>);
+
+} // namespace
@@ -0,0 +1,48 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <string_view>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/http/string_body.hpp>
+#include <boost/beast/http/verb.hpp>
+
+#include "fawkes/request.hpp"
+
+namespace {
+
+namespace http = boost::beast::http;
+
+// Rebuilds the request from a raw beast message each iteration, the way a recycled
+// per-connection request is reset for every keep-alive request. Target parsing
+// dominates, so the three corpora pick the plain fast path, the query path and the
+// escaped slow path apart.
+void reset_loop(benchmark::State& state, std::string_view target) {
+    fawkes::request req;
+    for ([[maybe_unused]] auto iter : state) {
+        http::request<http::string_body> raw{http::verb::get, target, 11};
+        req.reset(std::move(raw));
+        benchmark::DoNotOptimize(req.path());
+    }
+}
+
+void bm_request_reset_plain_path(benchmark::State& state) {
+    reset_loop(state, "/api/v1/users/12345");
+}
+
+void bm_request_reset_with_query(benchmark::State& state) {
+    reset_loop(state, "/search?q=coffee&page=2&sort=desc");
+}
+
+void bm_request_reset_escaped(benchmark::State& state) {
+    reset_loop(state, "/files/a%20b/c%2Bd?q=%E2%98%95&lang=en");
+}
+
+BENCHMARK(bm_request_reset_plain_path);
+BENCHMARK(bm_request_reset_with_query);
+BENCHMARK(bm_request_reset_escaped);
+
+} // namespace
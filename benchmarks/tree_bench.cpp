@@ -0,0 +1,143 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/awaitable.hpp>
+#include <fmt/format.h>
+
+#include "fawkes/middleware.hpp"
+#include "fawkes/path_params.hpp"
+#include "fawkes/tree.hpp"
+
+namespace {
+
+namespace asio = boost::asio;
+
+fawkes::route_handler_t make_handler() {
+    return [](fawkes::request&, fawkes::response&)
+               -> asio::awaitable<fawkes::middleware_result> {
+        co_return fawkes::middleware_result::proceed;
+    };
+}
+
+// 1,000 routes shaped like a mid-sized REST service: 800 static paths spread across
+// four API versions, 150 param routes and 50 catch-alls.
+std::vector<std::string> route_corpus() {
+    std::vector<std::string> routes;
+    routes.reserve(1000);
+    for (int ver = 1; ver <= 4; ++ver) {
+        for (int i = 0; i < 200; ++i) {
+            routes.push_back(fmt::format("/api/v{}/resource-{}/items", ver, i));
+        }
+    }
+    for (int i = 0; i < 150; ++i) {
+        routes.push_back(fmt::format("/api/v1/resource-{}/items/:id", i));
+    }
+    for (int i = 0; i < 50; ++i) {
+        routes.push_back(fmt::format("/assets-{}/*filepath", i));
+    }
+    return routes;
+}
+
+const fawkes::node& source_tree() {
+    static const fawkes::node tree = [] {
+        fawkes::node root;
+        for (const auto& route : route_corpus()) {
+            root.add_route(route, make_handler());
+        }
+        return root;
+    }();
+    return tree;
+}
+
+const fawkes::compiled_tree& frozen_tree() {
+    static const fawkes::compiled_tree tree = [] {
+        fawkes::node root;
+        for (const auto& route : route_corpus()) {
+            root.add_route(route, make_handler());
+        }
+        return fawkes::compiled_tree{std::move(root)};
+    }();
+    return tree;
+}
+
+template<typename Tree>
+void locate_loop(benchmark::State& state, const Tree& tree, std::string_view target) {
+    fawkes::path_params params;
+    for ([[maybe_unused]] auto iter : state) {
+        params.clear();
+        const auto* entry = tree.locate(target, params);
+        benchmark::DoNotOptimize(entry);
+    }
+}
+
+void bm_node_locate_static(benchmark::State& state) {
+    locate_loop(state, source_tree(), "/api/v3/resource-157/items");
+}
+
+void bm_node_locate_param(benchmark::State& state) {
+    locate_loop(state, source_tree(), "/api/v1/resource-42/items/1234567");
+}
+
+void bm_node_locate_catch_all(benchmark::State& state) {
+    locate_loop(state, source_tree(), "/assets-7/css/site.min.css");
+}
+
+void bm_node_locate_miss(benchmark::State& state) {
+    locate_loop(state, source_tree(), "/api/v9/resource-42/items");
+}
+
+void bm_compiled_locate_static(benchmark::State& state) {
+    locate_loop(state, frozen_tree(), "/api/v3/resource-157/items");
+}
+
+void bm_compiled_locate_param(benchmark::State& state) {
+    locate_loop(state, frozen_tree(), "/api/v1/resource-42/items/1234567");
+}
+
+void bm_compiled_locate_catch_all(benchmark::State& state) {
+    locate_loop(state, frozen_tree(), "/assets-7/css/site.min.css");
+}
+
+void bm_compiled_locate_miss(benchmark::State& state) {
+    locate_loop(state, frozen_tree(), "/api/v9/resource-42/items");
+}
+
+// A rotating mix defeats the branch predictor's memorization of a single target.
+void bm_compiled_locate_mixed(benchmark::State& state) {
+    constexpr std::array<std::string_view, 4> targets{
+        "/api/v3/resource-157/items",
+        "/api/v1/resource-42/items/1234567",
+        "/assets-7/css/site.min.css",
+        "/api/v9/resource-42/items",
+    };
+
+    const auto& tree = frozen_tree();
+    fawkes::path_params params;
+    std::size_t idx = 0;
+    for ([[maybe_unused]] auto iter : state) {
+        params.clear();
+        const auto* entry = tree.locate(targets[idx], params);
+        benchmark::DoNotOptimize(entry);
+        idx = (idx + 1) % targets.size();
+    }
+}
+
+BENCHMARK(bm_node_locate_static);
+BENCHMARK(bm_node_locate_param);
+BENCHMARK(bm_node_locate_catch_all);
+BENCHMARK(bm_node_locate_miss);
+BENCHMARK(bm_compiled_locate_static);
+BENCHMARK(bm_compiled_locate_param);
+BENCHMARK(bm_compiled_locate_catch_all);
+BENCHMARK(bm_compiled_locate_miss);
+BENCHMARK(bm_compiled_locate_mixed);
+
+} // namespace
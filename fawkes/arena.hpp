@@ -0,0 +1,59 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/container/pmr/memory_resource.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+
+namespace fawkes {
+
+// A per-session bump allocator: allocations are pointer bumps into one block and are
+// all invalidated together by `reset()`, which the server calls between keep-alive
+// requests -- the textbook lifetime of per-request scratch data.
+// Handlers reach it through `request::arena()` and can hand `resource()` straight to
+// anything speaking `boost::container::pmr`, including `boost::json::storage_ptr`, so
+// per-request json values build and serialize without touching malloc.
+// Overflowing the initial block falls back to the default resource; those blocks are
+// returned on the next `reset()`.
+class arena {
+public:
+    static constexpr std::size_t default_capacity = 16U * 1024U;
+
+    explicit arena(std::size_t initial_capacity = default_capacity)
+        : buffer_(initial_capacity),
+          resource_(buffer_.data(), buffer_.size()) {}
+
+    ~arena() = default;
+
+    // The resource refers into `buffer_`.
+    arena(const arena&) = delete;
+    arena(arena&&) = delete;
+    arena& operator=(const arena&) = delete;
+    arena& operator=(arena&&) = delete;
+
+    // Rewinds to the initial block; everything allocated since construction or the
+    // previous reset is invalidated.
+    void reset() noexcept {
+        resource_.release();
+    }
+
+    [[nodiscard]] boost::container::pmr::memory_resource* resource() noexcept {
+        return &resource_;
+    }
+
+    [[nodiscard]] void* allocate(std::size_t bytes,
+                                 std::size_t alignment = alignof(std::max_align_t)) {
+        return resource_.allocate(bytes, alignment);
+    }
+
+private:
+    std::vector<std::byte> buffer_;
+    boost::container::pmr::monotonic_buffer_resource resource_;
+};
+
+} // namespace fawkes
@@ -0,0 +1,51 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+
+#include <boost/json.hpp>
+#include <doctest/doctest.h>
+
+#include "fawkes/arena.hpp"
+
+namespace {
+
+namespace json = boost::json;
+
+TEST_SUITE_BEGIN("Arena");
+
+TEST_CASE("Reset rewinds to the initial block") {
+    fawkes::arena arena(128);
+
+    auto* first = arena.allocate(64);
+    auto* second = arena.allocate(32);
+    CHECK_NE(first, second);
+
+    arena.reset();
+
+    // The block is reused from its start.
+    CHECK_EQ(arena.allocate(64), first);
+}
+
+TEST_CASE("Allocations beyond the initial block fall back to the heap") {
+    fawkes::arena arena(64);
+    CHECK_NE(arena.allocate(1024), nullptr);
+    arena.reset();
+}
+
+TEST_CASE("boost.json builds values on the arena") {
+    fawkes::arena arena;
+
+    json::object obj(arena.resource());
+    obj["name"] = "fawkes";
+    obj["port"] = 8080;
+    CHECK_EQ(json::serialize(obj), R"({"name":"fawkes","port":8080})");
+
+    const auto parsed = json::parse(R"({"pi":3.14})", arena.resource());
+    CHECK_EQ(parsed.at("pi").as_double(), doctest::Approx(3.14));
+}
+
+TEST_SUITE_END(); // Arena
+
+} // namespace
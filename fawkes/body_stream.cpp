@@ -0,0 +1,58 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/body_stream.hpp"
+
+#include <cstddef>
+#include <system_error>
+
+#include <boost/asio/as_tuple.hpp>
+#include <boost/beast/http/error.hpp>
+#include <boost/beast/http/read.hpp>
+#include <esl/ignore_unused.h>
+
+namespace fawkes {
+
+asio::awaitable<std::size_t> body_stream::read_some(asio::mutable_buffer out) {
+#if defined(FAWKES_ENABLE_TLS)
+    if (tls_ != nullptr) {
+        co_return co_await read_some_from(*tls_, out);
+    }
+#endif
+    co_return co_await read_some_from(*stream_, out);
+}
+
+template<typename Stream>
+asio::awaitable<std::size_t> body_stream::read_some_from(Stream& stream,
+                                                         asio::mutable_buffer out) {
+    if (parser_.is_done() || out.size() == 0) {
+        co_return 0U;
+    }
+
+    auto& body = parser_.get().body();
+    body.data = out.data();
+    body.size = out.size();
+
+    auto [ec, bytes_consumed] = co_await http::async_read(stream, buf_, parser_, asio::as_tuple);
+    wire_bytes_ += bytes_consumed;
+
+    // `need_buffer` merely signals the given buffer is full.
+    if (ec && ec != http::error::need_buffer) {
+        throw std::system_error(ec);
+    }
+
+    const auto bytes_read = out.size() - body.size;
+    body.data = nullptr;
+    body.size = 0U;
+    co_return bytes_read;
+}
+
+asio::awaitable<void> body_stream::drain() {
+    char sink[4096]; // NOLINT(*-magic-numbers)
+    while (!parser_.is_done()) {
+        esl::ignore_unused(co_await read_some(asio::buffer(sink)));
+    }
+}
+
+} // namespace fawkes
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/http/buffer_body.hpp>
+#include <boost/beast/http/parser.hpp>
+#include <boost/beast/http/string_body.hpp>
+#include <boost/optional/optional.hpp>
+
+#include "fawkes/tls_stream.hpp"
+
+namespace fawkes {
+
+namespace asio = boost::asio;
+namespace beast = boost::beast;
+namespace http = boost::beast::http;
+
+// Incremental reader over a request body.
+// Created by the server for routes registered via `router::add_stream_route()`; a handler
+// obtains it from `request::body_reader()` and pulls body chunks into its own buffer, so
+// the body never needs to be fully buffered in memory.
+class body_stream {
+public:
+    // `parser` must have its header fully parsed and no body octets consumed yet.
+    body_stream(beast::tcp_stream& stream,
+                beast::flat_buffer& buf,
+                http::request_parser<http::string_body>&& parser)
+        : stream_(&stream),
+          buf_(buf),
+          parser_(std::move(parser)) {}
+
+#if defined(FAWKES_ENABLE_TLS)
+    // Same reader over a TLS session; the parser sees the decrypted octets.
+    body_stream(tls_stream& stream,
+                beast::flat_buffer& buf,
+                http::request_parser<http::string_body>&& parser)
+        : tls_(&stream),
+          buf_(buf),
+          parser_(std::move(parser)) {}
+#endif
+
+    ~body_stream() = default;
+
+    body_stream(const body_stream&) = delete;
+    body_stream(body_stream&&) = delete;
+    body_stream& operator=(const body_stream&) = delete;
+    body_stream& operator=(body_stream&&) = delete;
+
+    // Reads up to `out.size()` bytes of the body into `out` and returns the number of
+    // bytes read; returns 0 only if the body is complete.
+    // Throws `std::system_error` on read failures.
+    [[nodiscard]] asio::awaitable<std::size_t> read_some(asio::mutable_buffer out);
+
+    [[nodiscard]] bool done() const noexcept {
+        return parser_.is_done();
+    }
+
+    // Value of the Content-Length field if present; chunked bodies have none.
+    [[nodiscard]] boost::optional<std::uint64_t> content_length() const {
+        return parser_.content_length();
+    }
+
+    // Reads and discards the remainder of the body.
+    [[nodiscard]] asio::awaitable<void> drain();
+
+    // Octets this reader pulled off the transport, for the server's byte counters.
+    // Body bytes already buffered when the reader was created were counted by the
+    // header-phase reads and are not included.
+    [[nodiscard]] std::uint64_t wire_bytes() const noexcept {
+        return wire_bytes_;
+    }
+
+private:
+    // The read path is generic over the transport; only the stream the parser is
+    // driven against differs between plaintext and TLS.
+    template<typename Stream>
+    [[nodiscard]] asio::awaitable<std::size_t> read_some_from(Stream& stream,
+                                                              asio::mutable_buffer out);
+
+    beast::tcp_stream* stream_{nullptr};
+#if defined(FAWKES_ENABLE_TLS)
+    tls_stream* tls_{nullptr};
+#endif
+    beast::flat_buffer& buf_;
+    http::request_parser<http::buffer_body> parser_;
+    std::uint64_t wire_bytes_{0};
+};
+
+} // namespace fawkes
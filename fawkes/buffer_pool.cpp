@@ -0,0 +1,36 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/buffer_pool.hpp"
+
+#include <utility>
+
+namespace fawkes {
+
+// static
+buffer_pool& buffer_pool::local() {
+    static thread_local buffer_pool pool;
+    return pool;
+}
+
+buffer_pool::lease buffer_pool::acquire() {
+    if (!free_.empty()) {
+        auto buf = std::move(free_.back());
+        free_.pop_back();
+        return {*this, std::move(buf)};
+    }
+
+    return {*this, beast::flat_buffer{}};
+}
+
+void buffer_pool::put(beast::flat_buffer&& buf) {
+    if (buf.capacity() > max_retained_buf_size || free_.size() >= max_pooled_buffers) {
+        return;
+    }
+
+    buf.clear();
+    free_.push_back(std::move(buf));
+}
+
+} // namespace fawkes
@@ -0,0 +1,79 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/beast/core/flat_buffer.hpp>
+
+namespace fawkes {
+
+namespace beast = boost::beast;
+
+// A pool of read buffers shared by sessions running on the same io thread.
+// A session rents a buffer on connect and returns it on disconnect, so steady-state
+// request handling performs no buffer allocations and memory stays warm in cache.
+// Pooled buffers also keep stable storage identities, which the io_uring backend
+// (see `FAWKES_IO_URING`) benefits from.
+// Instances are not thread-safe; use `local()` to access the pool of the calling thread.
+class buffer_pool {
+public:
+    // Movable RAII handle returning the rented buffer to its pool on destruction.
+    class lease {
+    public:
+        lease(buffer_pool& pool, beast::flat_buffer&& buf) noexcept
+            : pool_(&pool),
+              buf_(std::move(buf)) {}
+
+        ~lease() {
+            if (pool_) {
+                pool_->put(std::move(buf_));
+            }
+        }
+
+        lease(lease&& other) noexcept
+            : pool_(std::exchange(other.pool_, nullptr)),
+              buf_(std::move(other.buf_)) {}
+
+        lease(const lease&) = delete;
+        lease& operator=(const lease&) = delete;
+        lease& operator=(lease&&) = delete;
+
+        [[nodiscard]] beast::flat_buffer& get() noexcept {
+            return buf_;
+        }
+
+    private:
+        buffer_pool* pool_;
+        beast::flat_buffer buf_;
+    };
+
+    // Buffers grown beyond this size are dropped instead of pooled, to keep pool memory
+    // bounded.
+    static constexpr std::size_t max_retained_buf_size = 64U * 1024U;
+
+    // Upper bound of idle buffers kept per thread.
+    static constexpr std::size_t max_pooled_buffers = 1024U;
+
+    // The pool of the calling thread.
+    [[nodiscard]] static buffer_pool& local();
+
+    // Rents a buffer, reusing a pooled one when available.
+    [[nodiscard]] lease acquire();
+
+    // Number of idle buffers currently pooled.
+    [[nodiscard]] std::size_t size() const noexcept {
+        return free_.size();
+    }
+
+private:
+    void put(beast::flat_buffer&& buf);
+
+    std::vector<beast::flat_buffer> free_;
+};
+
+} // namespace fawkes
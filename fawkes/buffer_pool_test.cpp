@@ -0,0 +1,60 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <cstddef>
+#include <optional>
+
+#include <doctest/doctest.h>
+
+#include "fawkes/buffer_pool.hpp"
+
+namespace {
+
+TEST_SUITE_BEGIN("BufferPool");
+
+TEST_CASE("Returned buffer is pooled and reused") {
+    fawkes::buffer_pool pool;
+    REQUIRE_EQ(pool.size(), 0);
+
+    std::optional<fawkes::buffer_pool::lease> lease(pool.acquire());
+    auto& buf = lease->get();
+    constexpr std::size_t bytes = 128U;
+    buf.commit(buf.prepare(bytes).size());
+    const auto capacity = buf.capacity();
+
+    lease.reset();
+    REQUIRE_EQ(pool.size(), 1);
+
+    auto reused = pool.acquire();
+    CHECK_EQ(pool.size(), 0);
+    CHECK_EQ(reused.get().capacity(), capacity);
+    CHECK_EQ(reused.get().size(), 0);
+}
+
+TEST_CASE("Oversized buffer is dropped instead of pooled") {
+    fawkes::buffer_pool pool;
+
+    {
+        auto lease = pool.acquire();
+        auto& buf = lease.get();
+        buf.commit(buf.prepare(fawkes::buffer_pool::max_retained_buf_size + 1).size());
+    }
+
+    CHECK_EQ(pool.size(), 0);
+}
+
+TEST_CASE("Moved-from lease does not return twice") {
+    fawkes::buffer_pool pool;
+
+    {
+        auto lease = pool.acquire();
+        auto stolen(std::move(lease));
+    }
+
+    CHECK_EQ(pool.size(), 1);
+}
+
+TEST_SUITE_END(); // BufferPool
+
+} // namespace
@@ -0,0 +1,54 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/canned_response.hpp"
+
+#include <utility>
+
+#include <boost/beast/http/field.hpp>
+
+#include "fawkes/mime.hpp"
+
+namespace fawkes {
+
+canned_response::canned_response(http::status status, std::string_view content_type,
+                                 std::string body) {
+    proto_.result(status);
+    proto_.set(http::field::content_type, content_type);
+    proto_.body() = std::move(body);
+    // Caches Content-Length in the prototype; `to_message()` copies never re-prepare.
+    proto_.prepare_payload();
+}
+
+// static
+canned_response canned_response::json(http::status status, std::string body) {
+    return {status, mime::json, std::move(body)};
+}
+
+// static
+canned_response canned_response::text(http::status status, std::string body) {
+    return {status, mime::text, std::move(body)};
+}
+
+canned_response& canned_response::with_header(std::string_view name, std::string_view value) {
+    proto_.set(name, value);
+    return *this;
+}
+
+void canned_response::apply(response& resp) const {
+    resp.set_status(proto_.result());
+    for (const auto& field : proto_.base()) {
+        resp.header().set(field.name_string(), field.value());
+    }
+    resp.body() = proto_.body();
+}
+
+http::message_generator canned_response::to_message(unsigned version, bool keep_alive) const {
+    auto resp = proto_;
+    resp.version(version);
+    resp.keep_alive(keep_alive);
+    return resp;
+}
+
+} // namespace fawkes
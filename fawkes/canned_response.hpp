@@ -0,0 +1,64 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/http/message_generator.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/http/string_body.hpp>
+
+#include "fawkes/response.hpp"
+
+namespace fawkes {
+
+namespace http = boost::beast::http;
+
+// A response with fixed status, headers and body, fully constructed once and reused for
+// every emission; think 404s under scanner traffic, per-policy CORS preflights, or
+// middleware aborts with static bodies.
+// Beast's `message_generator` cannot carry raw pre-serialized bytes, so the canned form
+// is a prepared message prototype: body building, header assembly and payload
+// preparation (Content-Length included) happen at construction, never per request.
+//
+// Two emission modes:
+//  - `apply()` writes the canned parts into a pooled `response`, so middlewares can
+//    still inspect or amend the outcome;
+//  - `to_message()` stamps out a ready-to-write `message_generator` directly, for paths
+//    that bypass the response object entirely.
+class canned_response {
+public:
+    canned_response(http::status status, std::string_view content_type, std::string body);
+
+    [[nodiscard]] static canned_response json(http::status status, std::string body);
+
+    [[nodiscard]] static canned_response text(http::status status, std::string body);
+
+    // Adds a fixed header field to the prototype; returns itself for chaining.
+    canned_response& with_header(std::string_view name, std::string_view value);
+
+    // Writes status, content-type and the cached body into `resp`, preserving whatever
+    // version and keep-alive `resp` already carries.
+    void apply(response& resp) const;
+
+    // Returns a ready-to-write message carrying the canned payload; `version` and
+    // `keep_alive` are taken from the request being answered.
+    [[nodiscard]] http::message_generator to_message(unsigned version, bool keep_alive) const;
+
+    [[nodiscard]] http::status status() const noexcept {
+        return proto_.result();
+    }
+
+    [[nodiscard]] const std::string& body() const noexcept {
+        return proto_.body();
+    }
+
+private:
+    http::response<http::string_body> proto_;
+};
+
+} // namespace fawkes
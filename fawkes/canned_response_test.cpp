@@ -0,0 +1,54 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <string>
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <doctest/doctest.h>
+
+#include "fawkes/canned_response.hpp"
+#include "fawkes/mime.hpp"
+#include "fawkes/response.hpp"
+
+namespace {
+
+namespace http = boost::beast::http;
+
+TEST_SUITE_BEGIN("Canned Response");
+
+TEST_CASE("Prototype is fully prepared at construction") {
+    const auto canned =
+        fawkes::canned_response::json(http::status::not_found,
+                                      R"({"error":{"message":"Unknown resource"}})");
+
+    CHECK_EQ(canned.status(), http::status::not_found);
+    CHECK_EQ(canned.body(), R"({"error":{"message":"Unknown resource"}})");
+}
+
+TEST_CASE("Apply writes into a pooled response without touching the framing") {
+    auto canned = fawkes::canned_response::text(http::status::too_many_requests, "slow down");
+    canned.with_header("Retry-After", "1");
+
+    fawkes::response resp(10, true);
+    canned.apply(resp);
+
+    CHECK_EQ(resp.status(), http::status::too_many_requests);
+    CHECK_EQ(resp.body(), "slow down");
+    CHECK_EQ(resp.header()[http::field::content_type], fawkes::mime::text);
+    CHECK_EQ(resp.header()["Retry-After"], "1");
+    CHECK_EQ(resp.as_impl().version(), 10);
+    CHECK(resp.as_impl().keep_alive());
+}
+
+TEST_CASE("Stamped messages carry the request framing") {
+    const auto canned = fawkes::canned_response::json(http::status::not_found, "{}");
+
+    CHECK(canned.to_message(11, true).keep_alive());
+    CHECK_FALSE(canned.to_message(11, false).keep_alive());
+}
+
+TEST_SUITE_END(); // Canned Response
+
+} // namespace
@@ -5,9 +5,12 @@
 #include "fawkes/cookie.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <ranges>
 #include <string>
 #include <string_view>
-#include <vector>
+#include <utility>
 
 #include <boost/url/authority_view.hpp>
 #include <boost/url/decode_view.hpp>
@@ -19,6 +22,8 @@
 #include <fmt/chrono.h>
 #include <spdlog/spdlog.h>
 
+#include "fawkes/swar.hpp"
+
 namespace fawkes {
 
 namespace urls = boost::urls;
@@ -53,47 +58,118 @@ bool valid_expires(std::chrono::sys_seconds expires) noexcept {
     return ymd.ok() && ymd.year() >= 1601y; // NOLINT(readability-magic-numbers)
 }
 
+// Long tracking-cookie headers are skipped over eight bytes at a time.
+std::size_t find_semicolon(std::string_view hay, std::size_t from) noexcept {
+    return detail::find_byte(hay, ';', from);
+}
+
+// Validates one `name=value` segment; the same rules back both the materialized map
+// and the single-name scans.
+std::optional<std::pair<std::string_view, std::string_view>>
+parse_cookie_pair(std::string_view segment) {
+    const auto trimmed = esl::strings::trim(segment, ascii_space);
+    if (trimmed.empty()) {
+        return std::nullopt;
+    }
+
+    // Must be `key=value`, while the `value` is allowed to be empty but the `name`
+    // can't be empty.
+    // Strictly, RFC doesn't allow an empty value without `=`, however a lot of popular
+    // frameworks choose to support this case.
+    auto name = trimmed;
+    std::string_view value;
+    if (const auto eq = trimmed.find('='); eq != std::string_view::npos) {
+        name = trimmed.substr(0, eq);
+        value = trimmed.substr(eq + 1);
+    }
+
+    if (name.empty() || value.find('=') != std::string_view::npos) {
+        SPDLOG_WARN("Malformed cookie entry, skipped; cookie={}", trimmed);
+        return std::nullopt;
+    }
+
+    if (!is_token(name)) {
+        SPDLOG_WARN("Name of the cookie entry is not a http token, skipped; name={}", name);
+        return std::nullopt;
+    }
+
+    // `urls::pct_string_view` has a rather relaxed parsing rule that would allow characters
+    // like whitespace.
+    if (urls::grammar::parse(value, urls::pct_encoded_rule(urls::unreserved_chars))
+            .has_error()) {
+        SPDLOG_WARN("Invalid value of the cookie entry, skipped; {}={}", name, value);
+        return std::nullopt;
+    }
+
+    return std::pair{name, value};
+}
+
 } // namespace
 
-void cookie_view::parse_cookie_value(std::string_view cookie_value) {
-    static constexpr std::string_view empty_value;
-
-    auto pairs = esl::strings::split(cookie_value, ';', esl::strings::skip_empty{});
-    for (auto p : pairs) {
-        const auto trimmed = esl::strings::trim(p, ascii_space);
-        auto fields = esl::strings::split(trimmed, '=')
-                          .to<std::vector<std::string_view>>();
-        // Must be `key=value`, while the `value` is allowed to be empty but the `name` can't
-        // be empty.
-        if (fields.size() > 2 || fields[0].empty()) {
-            SPDLOG_WARN("Malformed cookie entry, skipped; cookie={}", trimmed);
-            continue;
+const cookie_view::cookie_map& cookie_view::cookies() const {
+    if (!cookies_.has_value()) {
+        cookies_.emplace();
+        if (begin_ != end_) {
+            const std::size_t cookie_cnt = estimate_cookie_count(begin_->value());
+            constexpr std::size_t should_reserve_minimum = 3;
+            if (cookie_cnt > should_reserve_minimum) {
+                cookies_->reserve(cookie_cnt);
+            }
+
+            for (const auto& field : std::ranges::subrange(begin_, end_)) {
+                parse_cookie_value(field.value());
+            }
         }
+    }
+    return *cookies_;
+}
 
-        // Strictly, RFC doesn't allow an empty value without `=`, however a lot of popular
-        // frameworks choose to support this case.
-        if (fields.size() == 1) {
-            fields.emplace_back(empty_value);
+void cookie_view::parse_cookie_value(std::string_view cookie_value) const {
+    std::size_t pos = 0;
+    while (pos < cookie_value.size()) {
+        const auto sep = find_semicolon(cookie_value, pos);
+        const auto pair = parse_cookie_pair(cookie_value.substr(pos, sep - pos));
+        pos = sep + 1;
+        if (pair.has_value()) {
+            // If there are multiple pairs with the same name, only store the first to be
+            // compliant with RFC first-match policy.
+            cookies_->insert({pair->first, urls::decode_view(pair->second)});
         }
+    }
+}
 
-        if (!is_token(fields[0])) {
-            SPDLOG_WARN("Name of the cookie entry is not a http token, skipped; name={}",
-                        fields[0]);
-            continue;
+std::optional<std::string_view> cookie_view::find_raw(std::string_view name) const {
+    for (const auto& field : std::ranges::subrange(begin_, end_)) {
+        const std::string_view value = field.value();
+        std::size_t pos = 0;
+        while (pos < value.size()) {
+            const auto sep = find_semicolon(value, pos);
+            const auto pair = parse_cookie_pair(value.substr(pos, sep - pos));
+            pos = sep + 1;
+            if (pair.has_value() && pair->first == name) {
+                return pair->second;
+            }
         }
+    }
+    return std::nullopt;
+}
 
-        // `urls::pct_string_view` has a rather relaxed parsing rule that would allow characters
-        // like whitespace.
-        if (urls::grammar::parse(fields[1], urls::pct_encoded_rule(urls::unreserved_chars))
-                .has_error()) {
-            SPDLOG_WARN("Invalid value of the cookie entry, skipped; {}={}", fields[0], fields[1]);
-            continue;
-        }
+std::optional<std::string> cookie_view::get(std::string_view name) const {
+    const auto raw = find_raw(name);
+    if (!raw.has_value()) {
+        return std::nullopt;
+    }
+
+    const urls::decode_view decoded{*raw};
+    return std::string(decoded.begin(), decoded.end());
+}
 
-        // If there are multiple pairs with the same name, only store the first to be compliant
-        // with RFC first-match policy.
-        cookies_.insert({fields[0], urls::decode_view(fields[1])});
+std::optional<urls::decode_view> cookie_view::get_view(std::string_view name) const {
+    const auto raw = find_raw(name);
+    if (!raw.has_value()) {
+        return std::nullopt;
     }
+    return urls::decode_view{*raw};
 }
 
 std::string cookie::to_string() const {
@@ -22,55 +22,56 @@ namespace fawkes {
 namespace http = boost::beast::http;
 namespace urls = boost::urls;
 
+// A lazy view over the Cookie headers of a request; must not outlive them.
+// Single-name lookups (`get()`, `get_view()`, `contains()`) scan the raw header bytes
+// for just that name -- headers carrying dozens of tracking cookies cost nothing beyond
+// the scan -- and the name->value map is materialized only by the accessors that need
+// the full parse (`size()`, `empty()`).
 class cookie_view {
 public:
     using iterator = http::request_header<>::iterator;
 
-    cookie_view(iterator begin, iterator end) {
-        if (begin == end) {
-            return;
-        }
+    cookie_view(iterator begin, iterator end) noexcept
+        : begin_(begin),
+          end_(end) {}
 
-        const std::size_t cookie_cnt = estimate_cookie_count(begin->value());
-        constexpr std::size_t should_reserve_minimum = 3;
-        if (cookie_cnt > should_reserve_minimum) {
-            cookies_.reserve(cookie_cnt);
-        }
-
-        for (const auto& field : std::ranges::subrange(begin, end)) {
-            parse_cookie_value(field.value());
-        }
-    }
-
-    [[nodiscard]] bool empty() const noexcept {
-        return cookies_.empty();
+    [[nodiscard]] bool empty() const {
+        return cookies().empty();
     }
 
-    [[nodiscard]] std::size_t size() const noexcept {
-        return cookies_.size();
+    [[nodiscard]] std::size_t size() const {
+        return cookies().size();
     }
 
     [[nodiscard]] bool contains(std::string_view name) const {
-        return cookies_.contains(name);
+        return find_raw(name).has_value();
     }
 
-    [[nodiscard]] std::optional<std::string> get(std::string_view name) const {
-        auto it = cookies_.find(name);
-        if (it == cookies_.end()) {
-            return std::nullopt;
-        }
+    [[nodiscard]] std::optional<std::string> get(std::string_view name) const;
 
-        return std::string(it->second.begin(), it->second.end());
-    }
+    // Allocation-free read: the value is returned as a lazily-decoding view over the
+    // encoded bytes; for escape-free values -- the common case -- decoding is the
+    // identity. Same first-match and validation rules as `get()`.
+    [[nodiscard]] std::optional<urls::decode_view> get_view(std::string_view name) const;
 
 private:
+    using cookie_map = boost::unordered_flat_map<std::string_view, urls::decode_view>;
+
     static std::size_t estimate_cookie_count(std::string_view value) {
         return static_cast<std::size_t>(std::ranges::count(value, ';')) + 1;
     }
 
-    void parse_cookie_value(std::string_view cookie_value);
+    // Builds (once) and returns the full name->value map.
+    [[nodiscard]] const cookie_map& cookies() const;
+
+    // Scans the headers for the first valid pair named `name`; returns its raw value.
+    [[nodiscard]] std::optional<std::string_view> find_raw(std::string_view name) const;
+
+    void parse_cookie_value(std::string_view cookie_value) const;
 
-    boost::unordered_flat_map<std::string_view, urls::decode_view> cookies_;
+    iterator begin_;
+    iterator end_;
+    mutable std::optional<cookie_map> cookies_; // Materialized on demand.
 };
 
 enum class same_site_policy : std::uint8_t {
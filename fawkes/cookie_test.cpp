@@ -127,6 +127,28 @@ TEST_CASE("Malformed cookie entry") {
     }
 }
 
+TEST_CASE("Read a single cookie without materializing the map") {
+    http::request_header<> req_header;
+    req_header.set(http::field::cookie, "sid=a%2Bb; theme=dark; theme=light");
+    auto [begin, end] = req_header.equal_range(http::field::cookie);
+    const fawkes::cookie_view cv(begin, end);
+
+    const auto sid = cv.get_view("sid");
+    REQUIRE(sid.has_value());
+    CHECK(*sid == "a+b"); // NOLINT(bugprone-unchecked-optional-access)
+
+    SUBCASE("first match wins") {
+        const auto theme = cv.get_view("theme");
+        REQUIRE(theme.has_value());
+        CHECK(*theme == "dark"); // NOLINT(bugprone-unchecked-optional-access)
+    }
+
+    SUBCASE("missing name") {
+        CHECK_FALSE(cv.get_view("missing").has_value());
+        CHECK_FALSE(cv.contains("missing"));
+    }
+}
+
 TEST_SUITE_END(); // Parsing Cookie Header
 
 TEST_SUITE_BEGIN("Stringify Cookie Struct");
@@ -0,0 +1,24 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace fawkes {
+namespace detail {
+
+// A process-unique id for objects that park per-thread state in thread-local maps.
+// Such entries cannot be invalidated from the owner's destructor -- it runs on one
+// thread, the maps live on many -- and heap addresses recycle, so keying by `this`
+// would hand a new instance the state of a destroyed one allocated at the same
+// address. Ids are never reused; a stale entry is simply never looked up again.
+[[nodiscard]] inline std::uint64_t next_instance_id() noexcept {
+    static std::atomic<std::uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+} // namespace detail
+} // namespace fawkes
@@ -9,11 +9,44 @@
 #include <stdexcept>
 #include <thread>
 
+#include <esl/ignore_unused.h>
 #include <spdlog/spdlog.h>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace fawkes {
 
-io_thread_pool::io_thread_pool(std::size_t num_threads) {
+namespace {
+
+// Pinning keeps an io thread's cache and -- through first-touch allocation of its
+// lazily created io state -- its memory on one core. Failure only costs locality, so
+// it is logged and ignored.
+void pin_to_cpu(std::jthread& thd, std::size_t cpu_idx) {
+#if defined(__linux__)
+    const auto num_cpus = std::thread::hardware_concurrency();
+    if (num_cpus == 0) {
+        return;
+    }
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu_idx % num_cpus, &cpus);
+    if (const int rv = pthread_setaffinity_np(thd.native_handle(), sizeof(cpus), &cpus);
+        rv != 0) {
+        SPDLOG_WARN("Failed to pin io thread to cpu; cpu={} rv={}", cpu_idx, rv);
+    }
+#else
+    esl::ignore_unused(thd, cpu_idx);
+    SPDLOG_WARN("Pinning io threads is not supported on this platform");
+#endif
+}
+
+} // namespace
+
+io_thread_pool::io_thread_pool(std::size_t num_threads, bool pin_threads) {
     if (num_threads == 0) {
         throw std::invalid_argument("number of threads cannot be 0");
     }
@@ -31,6 +64,9 @@ io_thread_pool::io_thread_pool(std::size_t num_threads) {
                 }
             }
         });
+        if (pin_threads) {
+            pin_to_cpu(ctx.thd, i);
+        }
     }
 }
 
@@ -5,10 +5,15 @@
 #pragma once
 
 #include <atomic>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <boost/asio/executor_work_guard.hpp>
@@ -22,8 +27,66 @@ class io_thread_pool {
 public:
     using executor_type = asio::io_context::executor_type;
 
+    // Accounting token for one connection: carries the chosen executor and releases
+    // its context's load slot on destruction, keeping per-context live-session counts
+    // exact without any session registry.
+    class session_slot {
+    public:
+        session_slot() = default;
+
+        session_slot(session_slot&& other) noexcept
+            : load_(std::exchange(other.load_, nullptr)),
+              ex_(std::exchange(other.ex_, std::nullopt)) {}
+
+        session_slot& operator=(session_slot&& other) noexcept {
+            if (this != &other) {
+                release();
+                load_ = std::exchange(other.load_, nullptr);
+                ex_ = std::exchange(other.ex_, std::nullopt);
+            }
+            return *this;
+        }
+
+        session_slot(const session_slot&) = delete;
+        session_slot& operator=(const session_slot&) = delete;
+
+        ~session_slot() {
+            release();
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept {
+            return load_ != nullptr;
+        }
+
+        // Must hold a slot.
+        [[nodiscard]] executor_type get_executor() const {
+            assert(static_cast<bool>(*this));
+            return *ex_; // NOLINT(bugprone-unchecked-optional-access)
+        }
+
+    private:
+        friend class io_thread_pool;
+
+        session_slot(std::atomic<std::int64_t>& load, executor_type ex)
+            : load_(&load),
+              ex_(std::move(ex)) {}
+
+        void release() noexcept {
+            if (load_ != nullptr) {
+                load_->fetch_sub(1, std::memory_order_relaxed);
+                load_ = nullptr;
+                ex_.reset();
+            }
+        }
+
+        std::atomic<std::int64_t>* load_{nullptr};
+        std::optional<executor_type> ex_;
+    };
+
     // Throws `std::invalid_argument` if `num_threads` is 0.
-    explicit io_thread_pool(std::size_t num_threads);
+    // When `pin_threads` is set, each io thread is pinned to one core; the io state a
+    // thread allocates lazily while running then lands NUMA-locally via first-touch.
+    explicit io_thread_pool(std::size_t num_threads, bool pin_threads = false);
 
     ~io_thread_pool() {
         stop();
@@ -34,12 +97,44 @@ public:
     io_thread_pool& operator=(const io_thread_pool&) = delete;
     io_thread_pool& operator=(io_thread_pool&&) = delete;
 
-    // Round-robin scheduling.
+    // Round-robin scheduling; connections handed out here are not load-accounted.
+    // Prefer `acquire()` for long-lived sessions.
     [[nodiscard]] executor_type get_executor() {
         const auto idx = next_io_executor_.fetch_add(1, std::memory_order_relaxed) % size();
         return pool_[idx].io_ctx_ptr->get_executor();
     }
 
+    // Hands the new connection to the least-loaded io_context, so long-lived heavy
+    // sessions spread out instead of piling onto one thread the way blind round-robin
+    // lets them. The linear scan is over at most a few dozen counters, far off the
+    // per-request path.
+    [[nodiscard]] session_slot acquire() {
+        std::size_t best = 0;
+        auto best_load = std::numeric_limits<std::int64_t>::max();
+        for (std::size_t i = 0; i < pool_.size(); ++i) {
+            const auto load = pool_[i].live_sessions->load(std::memory_order_relaxed);
+            if (load < best_load) {
+                best = i;
+                best_load = load;
+            }
+        }
+        pool_[best].live_sessions->fetch_add(1, std::memory_order_relaxed);
+        return {*pool_[best].live_sessions, pool_[best].io_ctx_ptr->get_executor()};
+    }
+
+    // Live accounted sessions on the `idx`-th context; `idx` must be less than `size()`.
+    [[nodiscard]] std::int64_t load_at(std::size_t idx) const {
+        assert(idx < size());
+        return pool_[idx].live_sessions->load(std::memory_order_relaxed);
+    }
+
+    // Executor of the `idx`-th io_context in the pool.
+    // `idx` must be less than `size()`.
+    [[nodiscard]] executor_type get_executor_at(std::size_t idx) {
+        assert(idx < size());
+        return pool_[idx].io_ctx_ptr->get_executor();
+    }
+
     // Blocks until the threads in the pool have completed all outstanding works.
     // After `join()` is called, it is unspecified whether new works submitted to the pool
     // would be executed.
@@ -65,11 +160,14 @@ public:
 private:
     struct thread_context {
         std::unique_ptr<asio::io_context> io_ctx_ptr;
+        // Held indirectly to keep the context movable.
+        std::unique_ptr<std::atomic<std::int64_t>> live_sessions;
         asio::executor_work_guard<executor_type> guard;
         std::jthread thd;
 
         thread_context()
             : io_ctx_ptr(std::make_unique<asio::io_context>(1)),
+              live_sessions(std::make_unique<std::atomic<std::int64_t>>(0)),
               guard(io_ctx_ptr->get_executor()) {}
     };
 
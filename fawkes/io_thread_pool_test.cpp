@@ -47,6 +47,41 @@ TEST_CASE("Round-robin scheduling") {
     sync.acquire();
 }
 
+TEST_CASE("Least-loaded scheduling with slot accounting") {
+    fawkes::io_thread_pool pool(2);
+
+    auto slot1 = pool.acquire();
+    auto slot2 = pool.acquire();
+    REQUIRE(static_cast<bool>(slot1));
+    REQUIRE(static_cast<bool>(slot2));
+
+    // One accounted session per context.
+    CHECK_EQ(pool.load_at(0), 1);
+    CHECK_EQ(pool.load_at(1), 1);
+
+    {
+        // The third lands on whichever frees up first.
+        auto slot3 = pool.acquire();
+        CHECK_EQ(pool.load_at(0) + pool.load_at(1), 3);
+    }
+    CHECK_EQ(pool.load_at(0) + pool.load_at(1), 2);
+
+    auto moved = std::move(slot1);
+    CHECK_FALSE(static_cast<bool>(slot1)); // NOLINT(bugprone-use-after-move)
+    CHECK(static_cast<bool>(moved));
+    CHECK_EQ(pool.load_at(0) + pool.load_at(1), 2);
+}
+
+TEST_CASE("Pinned pool still runs posted work") {
+    fawkes::io_thread_pool pool(2, true);
+
+    std::binary_semaphore sync{0};
+    asio::post(pool.acquire().get_executor(), [&sync] {
+        sync.release();
+    });
+    sync.acquire();
+}
+
 TEST_SUITE_END(); // IO Thread Pool
 
 } // namespace
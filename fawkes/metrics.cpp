@@ -0,0 +1,158 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/metrics.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <fmt/format.h>
+
+namespace fawkes {
+
+namespace {
+
+constexpr std::array<std::string_view, metrics_registry::num_phases> phase_names{
+    "read", "handle", "write"};
+
+constexpr std::array<std::string_view, metrics_registry::num_status_classes> class_names{
+    "1xx", "2xx", "3xx", "4xx", "5xx"};
+
+// Upper bound of bucket `idx` in seconds; every sample in buckets 0..idx took at most
+// 2^idx microseconds.
+double bucket_upper_bound_secs(std::size_t idx) noexcept {
+    return std::ldexp(1.0, static_cast<int>(idx)) / 1e6;
+}
+
+} // namespace
+
+metrics_registry::shard& metrics_registry::local_shard() {
+    // Keyed by the registry's never-reused id so multiple servers in one process never
+    // share a line, and so a registry allocated at a destroyed one's address cannot
+    // inherit its freed shards and turn record_* calls into use-after-free.
+    static thread_local boost::unordered_flat_map<std::uint64_t, shard*> tls_shards;
+
+    const auto [it, inserted] = tls_shards.try_emplace(id_, nullptr);
+    if (inserted) {
+        auto owned = std::make_unique<shard>();
+        it->second = owned.get();
+        const std::lock_guard lock(shards_mutex_);
+        shards_.push_back(std::move(owned));
+    }
+    return *it->second;
+}
+
+void metrics_registry::record_session() noexcept {
+    local_shard().sessions_accepted.fetch_add(1, std::memory_order_relaxed);
+}
+
+void metrics_registry::record_request(std::uint32_t status_code) noexcept {
+    const auto cls = status_code / 100U;
+    if (cls < 1U || cls > num_status_classes) {
+        return;
+    }
+    local_shard().requests_by_class[cls - 1U].fetch_add(1, std::memory_order_relaxed);
+}
+
+void metrics_registry::record_bytes_in(std::uint64_t bytes) noexcept {
+    local_shard().bytes_in.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void metrics_registry::record_bytes_out(std::uint64_t bytes) noexcept {
+    local_shard().bytes_out.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void metrics_registry::record_latency(phase ph, std::chrono::nanoseconds elapsed) noexcept {
+    const auto us_count = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    const auto us = us_count > 0 ? static_cast<std::uint64_t>(us_count) : 0U;
+    const auto idx = std::min<std::size_t>(std::bit_width(us), num_latency_buckets - 1);
+
+    auto& hist = local_shard().latency[static_cast<std::size_t>(ph)];
+    hist.buckets[idx].fetch_add(1, std::memory_order_relaxed);
+    hist.sum_us.fetch_add(us, std::memory_order_relaxed);
+}
+
+std::string metrics_registry::render_prometheus(std::size_t live_sessions) const {
+    struct totals {
+        std::uint64_t sessions_accepted{0};
+        std::uint64_t bytes_in{0};
+        std::uint64_t bytes_out{0};
+        std::array<std::uint64_t, num_status_classes> requests_by_class{};
+        std::array<std::array<std::uint64_t, num_latency_buckets>, num_phases> buckets{};
+        std::array<std::uint64_t, num_phases> sum_us{};
+    };
+
+    totals agg;
+    {
+        const std::lock_guard lock(shards_mutex_);
+        for (const auto& shard_ptr : shards_) {
+            const auto& sd = *shard_ptr;
+            agg.sessions_accepted += sd.sessions_accepted.load(std::memory_order_relaxed);
+            agg.bytes_in += sd.bytes_in.load(std::memory_order_relaxed);
+            agg.bytes_out += sd.bytes_out.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < num_status_classes; ++i) {
+                agg.requests_by_class[i] +=
+                    sd.requests_by_class[i].load(std::memory_order_relaxed);
+            }
+            for (std::size_t ph = 0; ph < num_phases; ++ph) {
+                for (std::size_t i = 0; i < num_latency_buckets; ++i) {
+                    agg.buckets[ph][i] +=
+                        sd.latency[ph].buckets[i].load(std::memory_order_relaxed);
+                }
+                agg.sum_us[ph] += sd.latency[ph].sum_us.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::string out;
+    out.reserve(4096);
+    const auto emit = [&out]<typename... Args>(fmt::format_string<Args...> format,
+                                               Args&&... args) {
+        fmt::format_to(std::back_inserter(out), format, std::forward<Args>(args)...);
+    };
+
+    emit("# TYPE fawkes_sessions_accepted_total counter\n");
+    emit("fawkes_sessions_accepted_total {}\n", agg.sessions_accepted);
+
+    emit("# TYPE fawkes_live_sessions gauge\n");
+    emit("fawkes_live_sessions {}\n", live_sessions);
+
+    emit("# TYPE fawkes_requests_total counter\n");
+    for (std::size_t i = 0; i < num_status_classes; ++i) {
+        emit("fawkes_requests_total{{class=\"{}\"}} {}\n", class_names[i],
+             agg.requests_by_class[i]);
+    }
+
+    emit("# TYPE fawkes_bytes_received_total counter\n");
+    emit("fawkes_bytes_received_total {}\n", agg.bytes_in);
+    emit("# TYPE fawkes_bytes_sent_total counter\n");
+    emit("fawkes_bytes_sent_total {}\n", agg.bytes_out);
+
+    emit("# TYPE fawkes_phase_duration_seconds histogram\n");
+    for (std::size_t ph = 0; ph < num_phases; ++ph) {
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i + 1 < num_latency_buckets; ++i) {
+            cumulative += agg.buckets[ph][i];
+            emit("fawkes_phase_duration_seconds_bucket{{phase=\"{}\",le=\"{:g}\"}} {}\n",
+                 phase_names[ph], bucket_upper_bound_secs(i), cumulative);
+        }
+        cumulative += agg.buckets[ph][num_latency_buckets - 1];
+        emit("fawkes_phase_duration_seconds_bucket{{phase=\"{}\",le=\"+Inf\"}} {}\n",
+             phase_names[ph], cumulative);
+        emit("fawkes_phase_duration_seconds_sum{{phase=\"{}\"}} {:g}\n", phase_names[ph],
+             static_cast<double>(agg.sum_us[ph]) / 1e6);
+        emit("fawkes_phase_duration_seconds_count{{phase=\"{}\"}} {}\n", phase_names[ph],
+             cumulative);
+    }
+
+    return out;
+}
+
+} // namespace fawkes
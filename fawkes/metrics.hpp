@@ -0,0 +1,85 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "fawkes/instance_id.hpp"
+
+namespace fawkes {
+
+// Run-time counters for the serve path. Each io thread records into its own
+// cache-line-aligned shard -- relaxed adds on exclusively owned lines, nothing
+// contended across the pool -- and scrapes aggregate lazily across all shards.
+// Latency histograms use power-of-two microsecond buckets, one bit_width per update.
+class metrics_registry {
+public:
+    enum class phase : std::uint8_t {
+        read = 0,
+        handle,
+        write,
+    };
+
+    static constexpr std::size_t num_latency_buckets = 28; // 1us up to ~2min, then +Inf.
+    static constexpr std::size_t num_phases = 3;
+    static constexpr std::size_t num_status_classes = 5;
+
+    metrics_registry() = default;
+
+    ~metrics_registry() = default;
+
+    // Shards are reached through thread-local pointers keyed by a process-unique
+    // instance id; the registry is expected to live as long as the server recording
+    // into it.
+    metrics_registry(const metrics_registry&) = delete;
+    metrics_registry(metrics_registry&&) = delete;
+    metrics_registry& operator=(const metrics_registry&) = delete;
+    metrics_registry& operator=(metrics_registry&&) = delete;
+
+    void record_session() noexcept;
+
+    // Counted per status class, i.e. 2xx/4xx/...; codes outside 1xx-5xx are dropped.
+    void record_request(std::uint32_t status_code) noexcept;
+
+    void record_bytes_in(std::uint64_t bytes) noexcept;
+
+    void record_bytes_out(std::uint64_t bytes) noexcept;
+
+    void record_latency(phase ph, std::chrono::nanoseconds elapsed) noexcept;
+
+    // Renders the aggregated view in Prometheus text exposition format.
+    // `live_sessions` is a gauge sampled by the caller at scrape time.
+    [[nodiscard]] std::string render_prometheus(std::size_t live_sessions) const;
+
+private:
+    struct histogram {
+        std::array<std::atomic<std::uint64_t>, num_latency_buckets> buckets{};
+        std::atomic<std::uint64_t> sum_us{};
+    };
+
+    struct alignas(64) shard {
+        std::atomic<std::uint64_t> sessions_accepted{};
+        std::atomic<std::uint64_t> bytes_in{};
+        std::atomic<std::uint64_t> bytes_out{};
+        std::array<std::atomic<std::uint64_t>, num_status_classes> requests_by_class{};
+        std::array<histogram, num_phases> latency{};
+    };
+
+    [[nodiscard]] shard& local_shard();
+
+    const std::uint64_t id_ = detail::next_instance_id();
+    mutable std::mutex shards_mutex_;
+    std::vector<std::unique_ptr<shard>> shards_;
+};
+
+} // namespace fawkes
@@ -0,0 +1,88 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <doctest/doctest.h>
+
+#include "fawkes/metrics.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+TEST_SUITE_BEGIN("Metrics Registry");
+
+TEST_CASE("Counters aggregate into Prometheus exposition") {
+    fawkes::metrics_registry registry;
+
+    registry.record_session();
+    registry.record_request(200);
+    registry.record_request(200);
+    registry.record_request(404);
+    registry.record_bytes_in(128);
+    registry.record_bytes_out(512);
+
+    const auto text = registry.render_prometheus(3);
+
+    CHECK_NE(text.find("fawkes_sessions_accepted_total 1\n"), std::string::npos);
+    CHECK_NE(text.find("fawkes_live_sessions 3\n"), std::string::npos);
+    CHECK_NE(text.find("fawkes_requests_total{class=\"2xx\"} 2\n"), std::string::npos);
+    CHECK_NE(text.find("fawkes_requests_total{class=\"4xx\"} 1\n"), std::string::npos);
+    CHECK_NE(text.find("fawkes_requests_total{class=\"5xx\"} 0\n"), std::string::npos);
+    CHECK_NE(text.find("fawkes_bytes_received_total 128\n"), std::string::npos);
+    CHECK_NE(text.find("fawkes_bytes_sent_total 512\n"), std::string::npos);
+
+    SUBCASE("Malformed status codes are dropped") {
+        registry.record_request(0);
+        registry.record_request(999);
+        const auto after = registry.render_prometheus(0);
+        CHECK_NE(after.find("fawkes_requests_total{class=\"2xx\"} 2\n"), std::string::npos);
+    }
+}
+
+TEST_CASE("Latency histogram is cumulative per phase") {
+    fawkes::metrics_registry registry;
+
+    registry.record_latency(fawkes::metrics_registry::phase::handle, 3us);
+    registry.record_latency(fawkes::metrics_registry::phase::handle, 100us);
+    // Out-of-range samples land in the final bucket but never overflow it.
+    registry.record_latency(fawkes::metrics_registry::phase::handle, 10min);
+
+    const auto text = registry.render_prometheus(0);
+
+    // 3us falls within le="4e-06"; 100us joins it by le="0.000128".
+    CHECK_NE(text.find("fawkes_phase_duration_seconds_bucket{phase=\"handle\",le=\"4e-06\"} 1\n"),
+             std::string::npos);
+    CHECK_NE(
+        text.find("fawkes_phase_duration_seconds_bucket{phase=\"handle\",le=\"0.000128\"} 2\n"),
+        std::string::npos);
+    CHECK_NE(text.find("fawkes_phase_duration_seconds_bucket{phase=\"handle\",le=\"+Inf\"} 3\n"),
+             std::string::npos);
+    CHECK_NE(text.find("fawkes_phase_duration_seconds_count{phase=\"handle\"} 3\n"),
+             std::string::npos);
+    CHECK_NE(text.find("fawkes_phase_duration_seconds_count{phase=\"read\"} 0\n"),
+             std::string::npos);
+}
+
+TEST_CASE("Shards recorded on other threads are visible at scrape") {
+    fawkes::metrics_registry registry;
+
+    registry.record_session();
+    std::thread worker([&registry] {
+        registry.record_session();
+        registry.record_request(200);
+    });
+    worker.join();
+
+    const auto text = registry.render_prometheus(0);
+    CHECK_NE(text.find("fawkes_sessions_accepted_total 2\n"), std::string::npos);
+    CHECK_NE(text.find("fawkes_requests_total{class=\"2xx\"} 1\n"), std::string::npos);
+}
+
+TEST_SUITE_END(); // Metrics Registry
+
+} // namespace
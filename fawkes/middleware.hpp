@@ -134,8 +134,60 @@ asio::awaitable<middleware_result> run_middlewares_post_handle(std::tuple<Mws...
     }
 }
 
+template<is_middleware M>
+middleware_result invoke_pre_handle_sync(M& middleware, request& req, response& resp) {
+    if constexpr (has_pre_handle<M>) {
+        return middleware.pre_handle(req, resp);
+    } else {
+        return middleware_result::proceed;
+    }
+}
+
+template<is_middleware M>
+middleware_result invoke_post_handle_sync(M& middleware, request& req, response& resp) {
+    if constexpr (has_post_handle<M>) {
+        return middleware.post_handle(req, resp);
+    } else {
+        return middleware_result::proceed;
+    }
+}
+
+// Synchronous folds over an all-synchronous tuple: plain calls, no coroutine frame.
+
+template<is_middleware... Mws>
+middleware_result run_sync_middlewares_pre_handle(std::tuple<Mws...>& middlewares,
+                                                  request& req,
+                                                  response& resp) {
+    using enum middleware_result;
+    const bool run_all = [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return ((invoke_pre_handle_sync(std::get<I>(middlewares), req, resp) == proceed) &&
+                ...);
+    }(std::make_index_sequence<sizeof...(Mws)>{});
+    return run_all ? proceed : abort;
+}
+
+template<is_middleware... Mws>
+middleware_result run_sync_middlewares_post_handle(std::tuple<Mws...>& middlewares,
+                                                   request& req,
+                                                   response& resp) {
+    using enum middleware_result;
+    constexpr auto N = sizeof...(Mws);
+    const bool run_all = [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return ((invoke_post_handle_sync(std::get<N - I - 1>(middlewares), req, resp) ==
+                 proceed) &&
+                ...);
+    }(std::make_index_sequence<N>{});
+    return run_all ? proceed : abort;
+}
+
 } // namespace detail
 
+// True when no middleware in the pack has a coroutine handle, i.e. the whole chain can
+// run synchronously.
+template<typename... Mws>
+inline constexpr bool all_sync_middlewares =
+    !((has_coro_pre_handle<Mws> || has_coro_post_handle<Mws>) || ...);
+
 // A type-erased middleware set.
 class middleware_chain {
 public:
@@ -149,6 +201,23 @@ public:
         assert(ptr != nullptr);
         auto& mws = *static_cast<middlewares_t*>(ptr);
 
+        sync_ = all_sync_middlewares<Mws...>;
+        if constexpr (all_sync_middlewares<Mws...>) {
+            mws_ptr_ = ptr;
+            if constexpr ((has_pre_handle<Mws> || ...)) {
+                sync_pre_ = [](void* raw_mws, request& req, response& resp) {
+                    return detail::run_sync_middlewares_pre_handle(
+                        *static_cast<middlewares_t*>(raw_mws), req, resp);
+                };
+            }
+            if constexpr ((has_post_handle<Mws> || ...)) {
+                sync_post_ = [](void* raw_mws, request& req, response& resp) {
+                    return detail::run_sync_middlewares_post_handle(
+                        *static_cast<middlewares_t*>(raw_mws), req, resp);
+                };
+            }
+        }
+
         if constexpr ((has_pre_handle<Mws> || ...) || (has_coro_pre_handle<Mws> || ...)) {
             pre_impl_ = [&mws](request& req, response& resp)
                 -> asio::awaitable<middleware_result> {
@@ -164,6 +233,25 @@ public:
         }
     }
 
+    // True when every configured middleware handles synchronously, or none is set;
+    // callers may then use `pre_handle_sync()`/`post_handle_sync()` and skip the
+    // coroutine path entirely.
+    [[nodiscard]] bool synchronous() const noexcept {
+        return sync_;
+    }
+
+    middleware_result pre_handle_sync(request& req, response& resp) const {
+        assert(sync_);
+        return sync_pre_ != nullptr ? sync_pre_(mws_ptr_, req, resp)
+                                    : middleware_result::proceed;
+    }
+
+    middleware_result post_handle_sync(request& req, response& resp) const {
+        assert(sync_);
+        return sync_post_ != nullptr ? sync_post_(mws_ptr_, req, resp)
+                                     : middleware_result::proceed;
+    }
+
     [[nodiscard]] asio::awaitable<middleware_result> pre_handle(request& req,
                                                                 response& resp) const {
         if (!pre_impl_) {
@@ -186,6 +274,10 @@ private:
     std::any middlewares_;
     std::function<asio::awaitable<middleware_result>(request&, response&)> pre_impl_;
     std::function<asio::awaitable<middleware_result>(request&, response&)> post_impl_;
+    void* mws_ptr_{nullptr};
+    middleware_result (*sync_pre_)(void*, request&, response&){nullptr};
+    middleware_result (*sync_post_)(void*, request&, response&){nullptr};
+    bool sync_{true};
 };
 
 struct middlewares {
@@ -0,0 +1,220 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/middlewares/access_log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/beast/http/verb.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <esl/ignore_unused.h>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include "fawkes/instance_id.hpp"
+
+namespace fawkes {
+namespace {
+
+// Sized so a record stays trivially copyable and cache-friendly; longer paths are
+// truncated in the log, not rejected.
+constexpr std::size_t max_logged_path = 120;
+
+struct record {
+    std::chrono::system_clock::time_point time;
+    std::uint64_t bytes;
+    std::uint32_t latency_us;
+    std::uint16_t status;
+    http::verb method;
+    std::uint8_t path_len;
+    char path[max_logged_path]; // NOLINT(*-avoid-c-arrays)
+};
+
+// Single-producer (one io thread) single-consumer (the drain thread) ring; a full ring
+// drops the record and bumps a counter instead of blocking the producer.
+class spsc_ring {
+public:
+    explicit spsc_ring(std::size_t capacity)
+        : slots_(std::bit_ceil(std::max<std::size_t>(capacity, 2U))),
+          mask_(slots_.size() - 1) {}
+
+    bool push(const record& rec) noexcept {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == slots_.size()) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        slots_[tail & mask_] = rec;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename F>
+    void drain(F&& fn) {
+        auto head = head_.load(std::memory_order_relaxed);
+        const auto tail = tail_.load(std::memory_order_acquire);
+        for (; head != tail; ++head) {
+            fn(slots_[head & mask_]);
+        }
+        head_.store(head, std::memory_order_release);
+    }
+
+    [[nodiscard]] std::uint64_t take_dropped() noexcept {
+        return dropped_.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<record> slots_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+};
+
+void format_record(std::string& batch, const record& rec) {
+    const auto method = http::to_string(rec.method);
+    fmt::format_to(std::back_inserter(batch), "{:%FT%H:%M:%S}Z {} {} {} {}B {}us\n",
+                   fmt::gmtime(std::chrono::system_clock::to_time_t(rec.time)),
+                   std::string_view{method.data(), method.size()},
+                   std::string_view{rec.path, rec.path_len},
+                   rec.status,
+                   rec.bytes,
+                   rec.latency_us);
+}
+
+} // namespace
+
+class access_log::impl {
+public:
+    explicit impl(options opts)
+        : opts_(std::move(opts)) {
+        if (!opts_.sink) {
+            opts_.sink = [](std::string_view batch) {
+                esl::ignore_unused(std::fwrite(batch.data(), 1, batch.size(), stdout));
+            };
+        }
+
+        drainer_ = std::jthread([this](const std::stop_token& stop_token) {
+            std::string batch;
+            std::condition_variable_any wakeup;
+            std::mutex mtx;
+            std::unique_lock lock(mtx);
+            while (!stop_token.stop_requested()) {
+                esl::ignore_unused(wakeup.wait_for(lock, stop_token, opts_.drain_interval,
+                                                   [&stop_token] {
+                                                       return stop_token.stop_requested();
+                                                   }));
+                drain_once(batch);
+            }
+        });
+    }
+
+    ~impl() {
+        drainer_.request_stop();
+        drainer_.join();
+
+        // Flush whatever the io threads logged after the last pass.
+        std::string batch;
+        drain_once(batch);
+    }
+
+    impl(const impl&) = delete;
+    impl(impl&&) = delete;
+    impl& operator=(const impl&) = delete;
+    impl& operator=(impl&&) = delete;
+
+    void append(const request& req, const response& resp) {
+        record rec;
+        rec.time = std::chrono::system_clock::now();
+        rec.bytes = resp.body().size();
+        rec.latency_us = 0;
+        if (const auto started = req.received_at();
+            started != std::chrono::steady_clock::time_point{}) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - started);
+            rec.latency_us = static_cast<std::uint32_t>(
+                std::min<std::chrono::microseconds::rep>(elapsed.count(), UINT32_MAX));
+        }
+        rec.status = static_cast<std::uint16_t>(resp.status_code());
+        rec.method = req.header().method();
+
+        const auto path = req.path().substr(0, max_logged_path);
+        std::memcpy(rec.path, path.data(), path.size());
+        rec.path_len = static_cast<std::uint8_t>(path.size());
+
+        esl::ignore_unused(local_ring().push(rec));
+    }
+
+private:
+    // One ring per (instance, io thread), keyed by the never-reused instance id so an
+    // impl constructed where a destroyed one lived cannot inherit a dangling ring
+    // pointer. Instances are expected to live as long as the router they are
+    // installed on.
+    spsc_ring& local_ring() {
+        static thread_local boost::unordered_flat_map<std::uint64_t, spsc_ring*> rings;
+        auto& slot = rings[id_];
+        if (slot == nullptr) {
+            const std::scoped_lock lock(rings_mutex_);
+            rings_.push_back(std::make_unique<spsc_ring>(opts_.ring_capacity));
+            slot = rings_.back().get();
+        }
+        return *slot;
+    }
+
+    void drain_once(std::string& batch) {
+        batch.clear();
+
+        std::vector<spsc_ring*> rings;
+        {
+            const std::scoped_lock lock(rings_mutex_);
+            rings.reserve(rings_.size());
+            for (const auto& ring : rings_) {
+                rings.push_back(ring.get());
+            }
+        }
+
+        for (auto* ring : rings) {
+            ring->drain([&batch](const record& rec) {
+                format_record(batch, rec);
+            });
+            if (const auto dropped = ring->take_dropped(); dropped > 0) {
+                fmt::format_to(std::back_inserter(batch),
+                               "access_log: {} records dropped\n", dropped);
+            }
+        }
+
+        if (!batch.empty()) {
+            opts_.sink(batch);
+        }
+    }
+
+    options opts_;
+    const std::uint64_t id_ = detail::next_instance_id();
+    std::mutex rings_mutex_;
+    std::vector<std::unique_ptr<spsc_ring>> rings_;
+    std::jthread drainer_;
+};
+
+access_log::access_log(options opts)
+    : impl_(std::make_shared<impl>(std::move(opts))) {}
+
+middleware_result access_log::post_handle(request& req, response& resp) const {
+    impl_->append(req, resp);
+    return middleware_result::proceed;
+}
+
+} // namespace fawkes
@@ -0,0 +1,53 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "fawkes/middleware.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+
+namespace fawkes {
+
+// Asynchronous batched access logging.
+// `post_handle` records a fixed-size binary record (method, path, status, latency,
+// bytes) into a per-io-thread SPSC ring buffer -- no formatting, no lock, no syscall on
+// the request path -- and a background thread periodically drains every ring, formats
+// the records and hands the batch to the sink in one call. When a ring fills up faster
+// than it drains, records are dropped and the drop count is reported in the log instead
+// of stalling the io thread.
+// Copies share one logging state, so the instance can be passed to `router::use()` by
+// value like any other middleware.
+class access_log {
+public:
+    struct options {
+        // Per-io-thread ring capacity in records; rounded up to a power of two.
+        std::size_t ring_capacity{4096};
+        std::chrono::milliseconds drain_interval{100};
+        // Receives formatted batches of newline-terminated lines from the drain thread;
+        // defaults to writing to stdout.
+        std::function<void(std::string_view)> sink;
+    };
+
+    access_log()
+        : access_log(options{}) {}
+
+    explicit access_log(options opts);
+
+    middleware_result post_handle(request& req, response& resp) const;
+
+private:
+    class impl;
+
+    std::shared_ptr<impl> impl_;
+};
+
+} // namespace fawkes
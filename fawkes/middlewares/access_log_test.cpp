@@ -0,0 +1,80 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <doctest/doctest.h>
+
+#include "fawkes/middleware.hpp"
+#include "fawkes/middlewares/access_log.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+
+namespace {
+
+namespace http = boost::beast::http;
+
+fawkes::request make_request(std::string_view target) {
+    fawkes::request::impl_type raw{http::verb::get, target, 11};
+    fawkes::request req(std::move(raw));
+    req.set_received_at(std::chrono::steady_clock::now());
+    return req;
+}
+
+TEST_SUITE_BEGIN("Middlewares/access_log");
+
+TEST_CASE("Records drain into formatted batches") {
+    std::mutex mtx;
+    std::string captured;
+
+    {
+        const fawkes::access_log logger({.drain_interval = std::chrono::hours(1),
+                                         .sink = [&](std::string_view batch) {
+                                             const std::scoped_lock lock(mtx);
+                                             captured.append(batch);
+                                         }});
+
+        auto req = make_request("/ping");
+        fawkes::response resp;
+        resp.json(http::status::ok, R"({"pong":true})");
+
+        CHECK_EQ(logger.post_handle(req, resp), fawkes::middleware_result::proceed);
+        // Destruction flushes the rings regardless of the drain interval.
+    }
+
+    CHECK_NE(captured.find("GET /ping 200"), std::string::npos);
+    CHECK_NE(captured.find("us\n"), std::string::npos);
+}
+
+TEST_CASE("Full rings drop records instead of blocking") {
+    std::string captured;
+
+    {
+        const fawkes::access_log logger({.ring_capacity = 2,
+                                         .drain_interval = std::chrono::hours(1),
+                                         .sink = [&](std::string_view batch) {
+                                             captured.append(batch);
+                                         }});
+
+        auto req = make_request("/busy");
+        fawkes::response resp;
+        resp.text(http::status::ok, "ok");
+        for (int i = 0; i < 5; ++i) {
+            logger.post_handle(req, resp);
+        }
+    }
+
+    CHECK_NE(captured.find("GET /busy 200"), std::string::npos);
+    CHECK_NE(captured.find("3 records dropped"), std::string::npos);
+}
+
+TEST_SUITE_END(); // Middlewares/access_log
+
+} // namespace
@@ -0,0 +1,244 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/middlewares/compression.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/zlib/deflate_stream.hpp>
+#include <boost/beast/zlib/error.hpp>
+#include <boost/beast/zlib/zlib.hpp>
+#include <boost/crc.hpp>
+#include <boost/system/error_code.hpp>
+
+#include "fawkes/response_stream.hpp"
+
+namespace fawkes {
+namespace {
+
+namespace zlib = boost::beast::zlib;
+
+// Rents a deflate context from the per-thread free list and returns it on destruction.
+// `post_handle` never suspends, so in practice one context per io thread suffices, but
+// the pool keeps the invariant explicit.
+class deflate_context_lease {
+public:
+    deflate_context_lease() {
+        auto& pool = free_list();
+        if (pool.empty()) {
+            ctx_ = std::make_unique<zlib::deflate_stream>();
+        } else {
+            ctx_ = std::move(pool.back());
+            pool.pop_back();
+        }
+    }
+
+    ~deflate_context_lease() {
+        free_list().push_back(std::move(ctx_));
+    }
+
+    deflate_context_lease(const deflate_context_lease&) = delete;
+    deflate_context_lease(deflate_context_lease&&) = delete;
+    deflate_context_lease& operator=(const deflate_context_lease&) = delete;
+    deflate_context_lease& operator=(deflate_context_lease&&) = delete;
+
+    [[nodiscard]] zlib::deflate_stream& get() noexcept {
+        return *ctx_;
+    }
+
+private:
+    static std::vector<std::unique_ptr<zlib::deflate_stream>>& free_list() {
+        static thread_local std::vector<std::unique_ptr<zlib::deflate_stream>> contexts;
+        return contexts;
+    }
+
+    std::unique_ptr<zlib::deflate_stream> ctx_;
+};
+
+// Appends the raw DEFLATE stream of `in` to `out`; beast's zlib produces no zlib or
+// gzip framing, callers wrap the result themselves.
+bool deflate_raw(zlib::deflate_stream& ds, int level, std::string_view in, std::string& out) {
+    ds.reset(level, 15, 8, zlib::Strategy::normal);
+
+    zlib::z_params zs{};
+    zs.next_in = in.data();
+    zs.avail_in = in.size();
+
+    const auto base = out.size();
+    const auto bound = ds.upper_bound(in.size());
+    out.resize(base + bound);
+    zs.next_out = out.data() + base;
+    zs.avail_out = bound;
+
+    boost::system::error_code ec;
+    ds.write(zs, zlib::Flush::finish, ec);
+    if (ec != zlib::error::end_of_stream) {
+        return false;
+    }
+
+    out.resize(base + bound - zs.avail_out);
+    return true;
+}
+
+void append_le32(std::string& out, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((value >> (i * 8)) & 0xFFU));
+    }
+}
+
+std::uint32_t crc32(std::string_view data) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data.data(), data.size());
+    return crc.checksum();
+}
+
+std::uint32_t adler32(std::string_view data) {
+    constexpr std::uint32_t mod = 65521;
+    std::uint32_t a = 1;
+    std::uint32_t b = 0;
+    for (const char ch : data) {
+        a = (a + static_cast<std::uint8_t>(ch)) % mod;
+        b = (b + a) % mod;
+    }
+    return (b << 16) | a;
+}
+
+// 10-byte gzip member header: magic, CM=deflate, no flags, no mtime, unknown OS.
+constexpr std::string_view gzip_header{"\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\xff", 10};
+
+// The HTTP "deflate" coding is the zlib format (RFC 1950): 2-byte header around the raw
+// stream plus an Adler-32 trailer.
+void append_zlib_header(std::string& out, int level) {
+    constexpr std::uint8_t cmf = 0x78; // CM=deflate, CINFO=32KB window.
+    const std::uint8_t flevel = level < 2 ? 0U : level < 6 ? 1U : level == 6 ? 2U : 3U;
+    std::uint8_t flg = static_cast<std::uint8_t>(flevel << 6U);
+    flg += 31U - static_cast<std::uint8_t>((cmf * 256U + flg) % 31U);
+    out.push_back(static_cast<char>(cmf));
+    out.push_back(static_cast<char>(flg));
+}
+
+// True if the coding is present and not disabled by a "q=0" parameter.
+bool accepts_coding(std::string_view accept_encoding, std::string_view name) {
+    while (!accept_encoding.empty()) {
+        const auto comma = accept_encoding.find(',');
+        auto token = accept_encoding.substr(0, comma);
+        accept_encoding = comma == std::string_view::npos
+                              ? std::string_view{}
+                              : accept_encoding.substr(comma + 1);
+
+        auto params = std::string_view{};
+        if (const auto semi = token.find(';'); semi != std::string_view::npos) {
+            params = token.substr(semi + 1);
+            token = token.substr(0, semi);
+        }
+
+        token.remove_prefix(std::min(token.find_first_not_of(' '), token.size()));
+        token = token.substr(0, token.find_last_not_of(' ') + 1);
+        if (token != name) {
+            continue;
+        }
+
+        if (const auto q = params.find("q=0"); q != std::string_view::npos) {
+            // "q=0" or "q=0.000" disables, "q=0.5" does not.
+            const auto rest = params.substr(q + 3);
+            return rest.find_first_of("123456789") < rest.find_first_of(",; ");
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+middleware_result compression::post_handle(request& req, response& resp) const {
+    if (!is_compressible(resp)) {
+        return middleware_result::proceed;
+    }
+
+    const auto chosen = negotiate(req);
+    if (chosen == coding::none) {
+        return middleware_result::proceed;
+    }
+
+    deflate_context_lease ctx;
+    std::string out;
+    if (chosen == coding::gzip) {
+        out.append(gzip_header);
+    } else {
+        append_zlib_header(out, opts_.level);
+    }
+
+    // A pathological body the codec rejects is sent uncompressed.
+    if (!deflate_raw(ctx.get(), opts_.level, resp.body(), out)) {
+        return middleware_result::proceed;
+    }
+
+    if (chosen == coding::gzip) {
+        append_le32(out, crc32(resp.body()));
+        append_le32(out, static_cast<std::uint32_t>(resp.body().size()));
+    } else {
+        const auto sum = adler32(resp.body());
+        for (int i = 3; i >= 0; --i) {
+            out.push_back(static_cast<char>((sum >> (i * 8)) & 0xFFU));
+        }
+    }
+
+    resp.body() = std::move(out);
+    resp.header().set(http::field::content_encoding,
+                      chosen == coding::gzip ? "gzip" : "deflate");
+    resp.header().insert(http::field::vary, "Accept-Encoding");
+    return middleware_result::proceed;
+}
+
+// static
+compression::coding compression::negotiate(const request& req) {
+    const auto it = req.header().find(http::field::accept_encoding);
+    if (it == req.header().end()) {
+        return coding::none;
+    }
+
+    if (accepts_coding(it->value(), "gzip")) {
+        return coding::gzip;
+    }
+    if (accepts_coding(it->value(), "deflate")) {
+        return coding::deflate;
+    }
+    return coding::none;
+}
+
+bool compression::is_compressible(const response& resp) const {
+    // File and streamed responses bypass `body()` entirely.
+    if (resp.has_file() || (resp.stream() != nullptr && resp.stream()->started())) {
+        return false;
+    }
+
+    if (resp.body().size() < opts_.min_size) {
+        return false;
+    }
+
+    if (resp.header().count(http::field::content_encoding) > 0) {
+        return false;
+    }
+
+    std::string_view content_type = resp.header()[http::field::content_type];
+    content_type = content_type.substr(0, content_type.find(';'));
+    if (content_type.empty()) {
+        return false;
+    }
+
+    for (const auto& eligible : opts_.content_types) {
+        if (content_type.starts_with(eligible)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace fawkes
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fawkes/middleware.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+
+namespace fawkes {
+
+// Content-encoding negotiation and in-place body compression, as a `post_handle`
+// middleware: it runs after the handler filled `response::body()` and before the server
+// prepares the payload, so Content-Length is computed from the compressed bytes.
+// Codings are negotiated from Accept-Encoding (gzip preferred, then deflate), and codec
+// contexts are rented from a per-io-thread pool, so steady-state compression performs
+// no context allocation.
+// Bodies below the size threshold, of non-listed content types, already encoded, or not
+// buffered (file and streamed responses) are left untouched.
+class compression {
+public:
+    struct options {
+        // zlib compression level, 1 (fastest) to 9 (smallest).
+        int level{6};
+        // Bodies smaller than this are not worth the codec round-trip.
+        std::size_t min_size{256};
+        // Content-type prefixes eligible for compression; matched against the value up
+        // to any ";charset=..." parameter.
+        std::vector<std::string> content_types{
+            "text/",
+            "application/json",
+            "application/javascript",
+            "application/xml",
+        };
+    };
+
+    compression()
+        : compression(options{}) {}
+
+    explicit compression(options opts)
+        : opts_(std::move(opts)) {}
+
+    middleware_result post_handle(request& req, response& resp) const;
+
+private:
+    enum class coding {
+        none,
+        gzip,
+        deflate,
+    };
+
+    [[nodiscard]] static coding negotiate(const request& req);
+
+    [[nodiscard]] bool is_compressible(const response& resp) const;
+
+    options opts_;
+};
+
+} // namespace fawkes
@@ -0,0 +1,122 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <string>
+#include <string_view>
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/zlib/error.hpp>
+#include <boost/beast/zlib/inflate_stream.hpp>
+#include <boost/beast/zlib/zlib.hpp>
+#include <boost/system/error_code.hpp>
+#include <doctest/doctest.h>
+
+#include "fawkes/middleware.hpp"
+#include "fawkes/middlewares/compression.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+
+namespace {
+
+namespace http = boost::beast::http;
+namespace zlib = boost::beast::zlib;
+
+std::string inflate_raw(std::string_view in, std::size_t original_size) {
+    zlib::inflate_stream ds;
+    zlib::z_params zs{};
+    zs.next_in = in.data();
+    zs.avail_in = in.size();
+
+    std::string out(original_size + 16, '\0');
+    zs.next_out = out.data();
+    zs.avail_out = out.size();
+
+    boost::system::error_code ec;
+    ds.write(zs, zlib::Flush::finish, ec);
+    REQUIRE_EQ(ec, zlib::error::end_of_stream);
+    out.resize(out.size() - zs.avail_out);
+    return out;
+}
+
+std::string sample_body() {
+    std::string body;
+    for (int i = 0; i < 64; ++i) {
+        body += R"({"answer":42},)";
+    }
+    return body;
+}
+
+TEST_SUITE_BEGIN("Middlewares/compression");
+
+TEST_CASE("Gzip round-trip") {
+    fawkes::request req;
+    req.header().set(http::field::accept_encoding, "gzip, deflate");
+
+    fawkes::response resp;
+    const auto body = sample_body();
+    resp.json(http::status::ok, body);
+
+    const fawkes::compression compressor;
+    REQUIRE_EQ(compressor.post_handle(req, resp), fawkes::middleware_result::proceed);
+
+    CHECK_EQ(resp.header()[http::field::content_encoding], "gzip");
+    CHECK_EQ(resp.header()[http::field::vary], "Accept-Encoding");
+    REQUIRE_LT(resp.body().size(), body.size());
+
+    // Strip the 10-byte gzip header and the 8-byte trailer around the raw stream.
+    const std::string_view framed = resp.body();
+    REQUIRE_GT(framed.size(), 18U);
+    CHECK_EQ(inflate_raw(framed.substr(10, framed.size() - 18), body.size()), body);
+}
+
+TEST_CASE("Falls back to deflate when gzip is disabled") {
+    fawkes::request req;
+    req.header().set(http::field::accept_encoding, "gzip;q=0, deflate");
+
+    fawkes::response resp;
+    const auto body = sample_body();
+    resp.json(http::status::ok, body);
+
+    const fawkes::compression compressor;
+    REQUIRE_EQ(compressor.post_handle(req, resp), fawkes::middleware_result::proceed);
+
+    CHECK_EQ(resp.header()[http::field::content_encoding], "deflate");
+
+    // Strip the 2-byte zlib header and the 4-byte Adler-32 trailer.
+    const std::string_view framed = resp.body();
+    REQUIRE_GT(framed.size(), 6U);
+    CHECK_EQ(inflate_raw(framed.substr(2, framed.size() - 6), body.size()), body);
+}
+
+TEST_CASE("Bodies not worth compressing pass through") {
+    const fawkes::compression compressor;
+
+    fawkes::request req;
+    req.header().set(http::field::accept_encoding, "gzip");
+    fawkes::response resp;
+
+    SUBCASE("below the size threshold") {
+        resp.json(http::status::ok, R"({"answer":42})");
+    }
+
+    SUBCASE("ineligible content type") {
+        resp.text(http::status::ok, sample_body());
+        resp.header().set(http::field::content_type, "image/png");
+    }
+
+    SUBCASE("no Accept-Encoding") {
+        req.header().erase(http::field::accept_encoding);
+        resp.json(http::status::ok, sample_body());
+    }
+
+    const auto body = resp.body();
+    CHECK_EQ(compressor.post_handle(req, resp), fawkes::middleware_result::proceed);
+    CHECK_EQ(resp.body(), body);
+    CHECK_EQ(resp.header().count(http::field::content_encoding), 0);
+}
+
+TEST_SUITE_END(); // Middlewares/compression
+
+} // namespace
@@ -0,0 +1,123 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/middlewares/rate_limit.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <esl/utility.h>
+
+namespace fawkes {
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct key_hash : std::hash<std::string_view> {
+    using is_transparent = void;
+    using is_avalanching = void;
+};
+
+} // namespace
+
+class rate_limit::shard {
+public:
+    boost::unordered_flat_map<std::string, bucket, key_hash, std::equal_to<>> buckets;
+};
+
+rate_limit::rate_limit(options opts)
+    : opts_(std::move(opts)),
+      rejected_(canned_response::json(http::status::too_many_requests,
+                                      R"({"error":{"message":"Too many requests"}})")) {}
+
+rate_limit::shard& rate_limit::local_shard() const {
+    // One table per (instance, io thread), keyed by the never-reused instance id so a
+    // new instance cannot inherit the buckets of a destroyed one that shared its
+    // address. Instances are expected to live as long as the router they are
+    // installed on; tables of destroyed instances are not reclaimed until their
+    // thread exits.
+    static thread_local boost::unordered_flat_map<std::uint64_t, std::unique_ptr<shard>>
+        shards;
+    auto& slot = shards[id_];
+    if (!slot) {
+        slot = std::make_unique<shard>();
+    }
+    return *slot;
+}
+
+middleware_result rate_limit::pre_handle(request& req, response& resp) const {
+    std::string ip_storage;
+    std::string_view key;
+    const auto keyed = std::visit(
+        esl::overloaded{
+            [&](by_client_ip) -> bool {
+                const auto& remote = req.remote();
+                if (remote == asio::ip::tcp::endpoint{}) {
+                    return false;
+                }
+                ip_storage = remote.address().to_string();
+                key = ip_storage;
+                return true;
+            },
+            [&](const by_header& policy) -> bool {
+                const auto it = req.header().find(policy.name);
+                if (it == req.header().end()) {
+                    return false;
+                }
+                key = it->value();
+                return true;
+            }},
+        opts_.key_policy);
+
+    // Requests the policy cannot key pass unlimited.
+    if (!keyed) {
+        return middleware_result::proceed;
+    }
+
+    auto& sh = local_shard();
+    const auto now = clock_type::now();
+
+    auto it = sh.buckets.find(key);
+    if (it == sh.buckets.end()) {
+        // A bucket refilled to capacity carries no state worth keeping; sweeping such
+        // idle buckets before admitting a new key bounds the table under traffic from
+        // many one-off addresses.
+        if (sh.buckets.size() >= opts_.max_keys_per_shard) {
+            const auto idle_cutoff =
+                std::chrono::duration_cast<clock_type::duration>(std::chrono::duration<double>(
+                    opts_.burst / opts_.tokens_per_second));
+            erase_if(sh.buckets, [now, idle_cutoff](const auto& entry) {
+                return now - entry.second.last_refill >= idle_cutoff;
+            });
+        }
+        it = sh.buckets.emplace(key, bucket{.tokens = opts_.burst, .last_refill = now}).first;
+    }
+
+    auto& tb = it->second;
+    const auto elapsed = std::chrono::duration<double>(now - tb.last_refill).count();
+    tb.tokens = std::min(opts_.burst, tb.tokens + elapsed * opts_.tokens_per_second);
+    tb.last_refill = now;
+
+    if (tb.tokens >= 1.0) {
+        tb.tokens -= 1.0;
+        return middleware_result::proceed;
+    }
+
+    rejected_.apply(resp);
+    const auto wait_secs = std::ceil((1.0 - tb.tokens) / opts_.tokens_per_second);
+    resp.header().set(http::field::retry_after,
+                      std::to_string(static_cast<long long>(wait_secs)));
+    return middleware_result::abort;
+}
+
+} // namespace fawkes
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <variant>
+
+#include "fawkes/canned_response.hpp"
+#include "fawkes/instance_id.hpp"
+#include "fawkes/middleware.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+
+namespace fawkes {
+
+// Token-bucket rate limiting, keyed by client IP or a request header.
+// Buckets are sharded per io thread: each thread owns a private key->bucket table, so
+// the request path takes no lock and touches no shared cache line, and refill is
+// computed lazily from timestamps rather than timer wakeups. A client whose connections
+// spread over k io threads can momentarily attain up to k times the configured rate;
+// with keep-alive pinning a connection to one thread this is an acceptable bound.
+// Rejections answer with a canned 429 and a Retry-After estimate.
+class rate_limit {
+public:
+    // Keys buckets by `request::remote()` address.
+    struct by_client_ip {};
+
+    // Keys buckets by the value of a request header, e.g. "X-Forwarded-For" behind a
+    // trusted proxy, or an API-key header. Requests missing the header pass unlimited.
+    struct by_header {
+        std::string name;
+    };
+
+    using key_policy_t = std::variant<by_client_ip, by_header>;
+
+    struct options {
+        // Steady-state refill rate.
+        double tokens_per_second;
+        // Bucket capacity, i.e. the largest tolerated burst.
+        double burst;
+        key_policy_t key_policy{by_client_ip{}};
+        // Per-shard bound on tracked keys; exceeding it sweeps idle buckets, so scanner
+        // traffic from many addresses cannot grow the tables without bound.
+        std::size_t max_keys_per_shard{65536};
+    };
+
+    explicit rate_limit(options opts);
+
+    middleware_result pre_handle(request& req, response& resp) const;
+
+private:
+    struct bucket {
+        double tokens;
+        std::chrono::steady_clock::time_point last_refill;
+    };
+
+    class shard;
+
+    [[nodiscard]] shard& local_shard() const;
+
+    options opts_;
+    canned_response rejected_;
+    const std::uint64_t id_ = detail::next_instance_id();
+};
+
+} // namespace fawkes
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/http/status.hpp>
+#include <doctest/doctest.h>
+
+#include "fawkes/middleware.hpp"
+#include "fawkes/middlewares/rate_limit.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+
+namespace {
+
+namespace asio = boost::asio;
+namespace http = boost::beast::http;
+
+asio::ip::tcp::endpoint make_remote(const char* addr) {
+    return {asio::ip::make_address(addr), 54321};
+}
+
+TEST_SUITE_BEGIN("Middlewares/rate_limit");
+
+TEST_CASE("Burst then reject") {
+    const fawkes::rate_limit limiter({.tokens_per_second = 1.0, .burst = 2.0});
+
+    fawkes::request req;
+    req.set_remote(make_remote("10.0.0.1"));
+
+    fawkes::response resp;
+    CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::proceed);
+    CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::proceed);
+
+    REQUIRE_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::abort);
+    CHECK_EQ(resp.status(), http::status::too_many_requests);
+    CHECK_FALSE(resp.header()["Retry-After"].empty());
+}
+
+TEST_CASE("Buckets are independent per key") {
+    const fawkes::rate_limit limiter({.tokens_per_second = 1.0, .burst = 1.0});
+
+    fawkes::request req;
+    fawkes::response resp;
+
+    req.set_remote(make_remote("10.0.0.1"));
+    CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::proceed);
+    CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::abort);
+
+    req.set_remote(make_remote("10.0.0.2"));
+    CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::proceed);
+}
+
+TEST_CASE("Key by header") {
+    const fawkes::rate_limit limiter({.tokens_per_second = 1.0,
+                                      .burst = 1.0,
+                                      .key_policy = fawkes::rate_limit::by_header{"X-Api-Key"}});
+
+    fawkes::request req;
+    fawkes::response resp;
+
+    SUBCASE("header value identifies the bucket") {
+        req.header().set("X-Api-Key", "alice");
+        CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::proceed);
+        CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::abort);
+
+        req.header().set("X-Api-Key", "bob");
+        CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::proceed);
+    }
+
+    SUBCASE("missing header passes unlimited") {
+        CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::proceed);
+        CHECK_EQ(limiter.pre_handle(req, resp), fawkes::middleware_result::proceed);
+    }
+}
+
+TEST_SUITE_END(); // Middlewares/rate_limit
+
+} // namespace
@@ -10,6 +10,7 @@ namespace fawkes {
 
 struct mime {
     static constexpr std::string_view json = "application/json";
+    static constexpr std::string_view octet_stream = "application/octet-stream";
     static constexpr std::string_view text = "text/plain";
 };
 
@@ -5,11 +5,12 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <optional>
 #include <stdexcept>
 #include <string_view>
-#include <vector>
 
+#include <boost/container/small_vector.hpp>
 #include <fmt/format.h>
 
 namespace fawkes {
@@ -31,6 +32,10 @@ public:
         ps_.push_back({key, value});
     }
 
+    void clear() noexcept {
+        ps_.clear();
+    }
+
     // Throws `std::out_of_range` if there is no match.
     [[nodiscard]] std::string_view get(std::string_view key) const {
         const auto it = std::ranges::find_if(ps_, [key](detail::param pam) {
@@ -52,11 +57,36 @@ public:
         return it->value;
     }
 
+    // Positional access, in the order params appear in the route pattern; a handler
+    // that knows its route skips the key comparison entirely.
+    // Throws `std::out_of_range` if `index` is out of bounds.
+    [[nodiscard]] std::string_view get(std::size_t index) const {
+        if (index >= ps_.size()) {
+            throw std::out_of_range(fmt::format("param at index={} not found", index));
+        }
+        return ps_[index].value;
+    }
+
+    template<std::size_t I>
+    [[nodiscard]] std::string_view get() const {
+        return get(I);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return ps_.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return ps_.empty();
+    }
+
     friend bool operator==(const path_params& lhs, const path_params& rhs) noexcept = default;
 
 private:
-    // TODO(KC): consider using boost/small_vector instead.
-    std::vector<detail::param> ps_;
+    // Routes rarely carry more than a handful of params; the inline capacity makes
+    // populating them in `node::locate()` allocation-free.
+    static constexpr std::size_t inline_params = 4;
+    boost::container::small_vector<detail::param, inline_params> ps_;
 };
 
 } // namespace fawkes
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <stdexcept>
+
+#include <doctest/doctest.h>
+
+#include "fawkes/path_params.hpp"
+
+namespace {
+
+TEST_SUITE_BEGIN("Path Params");
+
+TEST_CASE("Indexed access follows pattern order") {
+    fawkes::path_params params;
+    params.add("user", "kc");
+    params.add("post", "42");
+
+    CHECK_EQ(params.size(), 2);
+    CHECK_EQ(params.get(0), "kc");
+    CHECK_EQ(params.get<1>(), "42");
+    CHECK_EQ(params.get("post"), params.get(1));
+    CHECK_THROWS_AS(params.get(2), std::out_of_range);
+}
+
+TEST_CASE("Inline capacity covers typical routes") {
+    fawkes::path_params params;
+    for (int i = 0; i < 4; ++i) {
+        params.add("k", "v");
+    }
+    CHECK_EQ(params.size(), 4);
+
+    params.clear();
+    CHECK(params.empty());
+}
+
+TEST_SUITE_END(); // Path Params
+
+} // namespace
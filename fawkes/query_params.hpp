@@ -4,16 +4,23 @@
 
 #pragma once
 
+#include <array>
+#include <charconv>
 #include <concepts>
 #include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 
+#include <boost/url/decode_view.hpp>
+#include <boost/url/encoding_opts.hpp>
+#include <boost/url/params_encoded_view.hpp>
 #include <boost/url/params_ref.hpp>
 #include <boost/url/params_view.hpp>
+#include <boost/url/pct_string_view.hpp>
 #include <esl/ignore_unused.h>
 
 namespace fawkes {
@@ -28,8 +35,9 @@ static_assert(std::is_nothrow_copy_constructible_v<urls::params_ref>);
 template<typename Impl>
 requires std::same_as<Impl, urls::params_view> || std::same_as<Impl, urls::params_ref>
 struct query_params_base {
-    explicit query_params_base(const Impl& impl) noexcept
-        : impl_(impl) {}
+    query_params_base(const Impl& impl, const urls::params_encoded_view& encoded) noexcept
+        : impl_(impl),
+          encoded_(encoded) {}
 
     [[nodiscard]] std::optional<std::string> get(std::string_view key) const {
         auto it = impl_.find(key);
@@ -49,7 +57,54 @@ struct query_params_base {
         return std::move((*it).value);
     }
 
+    // Allocation-free read: the value is returned as a lazily-decoding view over the
+    // encoded bytes, which compares against string literals without materializing a
+    // string; for escape-free values -- the common case -- decoding is the identity.
+    [[nodiscard]] std::optional<urls::decode_view> get_view(std::string_view key) const {
+        for (const auto param : encoded_) {
+            if (decoded(param.key) == key) {
+                return decoded(param.value);
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Parses the value in place via `std::from_chars`; no value, trailing garbage, or
+    // overflow all yield `std::nullopt`.
+    template<std::integral T>
+    [[nodiscard]] std::optional<T> get_as(std::string_view key) const {
+        const auto view = get_view(key);
+        if (!view.has_value()) {
+            return std::nullopt;
+        }
+
+        // Decoded digits of any 64-bit integer fit on the stack.
+        std::array<char, 32> buf; // NOLINT(*-member-init)
+        std::size_t len = 0;
+        for (const char ch : *view) {
+            if (len == buf.size()) {
+                return std::nullopt;
+            }
+            buf[len++] = ch;
+        }
+
+        T value{};
+        const auto [ptr, ec] = std::from_chars(buf.data(), buf.data() + len, value);
+        if (ec != std::errc{} || ptr != buf.data() + len) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    // Query values decode '+' as space, like the decoded accessors above.
+    [[nodiscard]] static urls::decode_view decoded(urls::pct_string_view sv) noexcept {
+        urls::encoding_opts opt;
+        opt.space_as_plus = true;
+        return urls::decode_view{sv, opt};
+    }
+
     Impl impl_;
+    urls::params_encoded_view encoded_;
 };
 
 } // namespace detail
@@ -59,7 +114,9 @@ public:
     using query_params_base::query_params_base;
 
     using query_params_base::get;
+    using query_params_base::get_as;
     using query_params_base::get_or;
+    using query_params_base::get_view;
 };
 
 class query_params_ref : private detail::query_params_base<urls::params_ref> {
@@ -67,7 +124,9 @@ public:
     using query_params_base::query_params_base;
 
     using query_params_base::get;
+    using query_params_base::get_as;
     using query_params_base::get_or;
+    using query_params_base::get_view;
 
     // If `key` is not contained, insert the param {key, value}.
     // Otherwise, one of the matching elements has its value changed to `value`; remaining elements
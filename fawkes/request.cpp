@@ -4,40 +4,135 @@
 
 #include "fawkes/request.hpp"
 
+#include <array>
 #include <string_view>
 #include <utility>
 
 #include <boost/beast/http/status.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/json/storage_ptr.hpp>
+#include <boost/system/error_code.hpp>
 #include <boost/url/parse.hpp>
 #include <boost/url/parse_query.hpp>
 #include <spdlog/spdlog.h>
 
+#include "fawkes/arena.hpp"
 #include "fawkes/errors.hpp"
 
 namespace fawkes {
 
+namespace json = boost::json;
+
+namespace {
+
+// Byte bitmap of characters that may appear verbatim in an origin-form path:
+// unreserved, sub-delims, ':', '@' and '/'. '%' is deliberately absent so escaped
+// paths take the grammar-driven parser below. Dots stay in: nothing in this tree
+// normalizes dot-segments, so they match routes literally either way.
+constexpr auto plain_path_chars = [] {
+    std::array<bool, 256> lut{};
+    constexpr std::string_view extras = "-._~!$&'()*+,;=:@/";
+    for (const char ch : extras) {
+        lut[static_cast<unsigned char>(ch)] = true;
+    }
+    for (char ch = 'a'; ch <= 'z'; ++ch) {
+        lut[static_cast<unsigned char>(ch)] = true;
+        lut[static_cast<unsigned char>(ch - 'a' + 'A')] = true;
+    }
+    for (char ch = '0'; ch <= '9'; ++ch) {
+        lut[static_cast<unsigned char>(ch)] = true;
+    }
+    return lut;
+}();
+
+// One branchless pass classifies the common case: rooted, every byte legal, no
+// escapes. Such a path is already its own decoded form and needs no parsing at all.
+bool is_plain_path(std::string_view path) noexcept {
+    bool ok = path.starts_with('/');
+    for (const unsigned char ch : path) {
+        ok &= plain_path_chars[ch];
+    }
+    return ok;
+}
+
+} // namespace
+
 request::request(impl_type&& req_impl)
     : impl_(std::move(req_impl)) {
-    const auto target = impl_.target();
-    const auto pos = target.find('?');
-    const auto path = target.substr(0, pos);
-    auto or_path = urls::parse_origin_form(path);
-    if (or_path.has_error()) {
-        throw http_error(http::status::bad_request, "invalid url path");
-    }
-
-    url_ = *or_path;
-    url_.path(urls::string_token::assign_to(path_));
-
-    if (pos != std::string_view::npos) {
-        // Discard whole query string if it is malformed.
-        const auto or_query = urls::parse_query(target.substr(pos + 1));
-        if (or_query.has_error()) {
-            SPDLOG_ERROR("malformed query string discarded");
-        } else {
-            url_.encoded_params().assign(or_query->begin(), or_query->end());
+    parse_target();
+}
+
+void request::reset(impl_type&& req_impl) {
+    impl_ = std::move(req_impl);
+    ps_.clear();
+    body_reader_ = nullptr;
+    parse_target();
+}
+
+void request::parse_target() {
+    url_.reset();
+    path_decoded_ = false;
+    query_valid_ = true;
+
+    const std::string_view target = impl_.target();
+    query_pos_ = target.find('?');
+    const auto path = target.substr(0, query_pos_);
+
+    // Paths the classification pass clears -- the overwhelming majority -- skip the
+    // grammar-driven parser entirely; `path()` views the target in place.
+    if (!is_plain_path(path)) {
+        const auto or_path = urls::parse_origin_form(path);
+        if (or_path.has_error()) {
+            throw http_error(http::status::bad_request, "invalid url path");
+        }
+
+        // Validation above is allocation-free; the decoded copy is produced only when
+        // the path actually carries escapes.
+        if (path.find('%') != std::string_view::npos) {
+            or_path->path(urls::string_token::assign_to(path_storage_));
+            path_decoded_ = true;
+        }
+    }
+
+    // Malformed query strings are diagnosed here but the whole query is discarded.
+    if (query_pos_ != std::string_view::npos &&
+        urls::parse_query(target.substr(query_pos_ + 1)).has_error()) {
+        SPDLOG_ERROR("malformed query string discarded");
+        query_valid_ = false;
+    }
+}
+
+json::value request::json() const {
+    constexpr auto opts = [] {
+        json::parse_options opt;
+        // Handlers binding into typed fields re-validate what matters anyway; skipping
+        // UTF-8 validation is the single biggest parse speedup.
+        opt.allow_invalid_utf8 = true;
+        return opt;
+    }();
+
+    const json::storage_ptr sp = arena_ != nullptr ? json::storage_ptr(arena_->resource())
+                                                   : json::storage_ptr();
+    boost::system::error_code ec;
+    auto value = json::parse(impl_.body(), ec, sp, opts);
+    if (ec) {
+        throw http_error(http::status::bad_request, "invalid json body");
+    }
+    return value;
+}
+
+urls::url& request::url() const {
+    if (!url_.has_value()) {
+        const std::string_view target = impl_.target();
+        // Both parts were validated in `parse_target()`; re-parsing views them without
+        // allocating.
+        url_.emplace(*urls::parse_origin_form(target.substr(0, query_pos_)));
+        if (query_valid_ && query_pos_ != std::string_view::npos) {
+            const auto or_query = urls::parse_query(target.substr(query_pos_ + 1));
+            url_->encoded_params().assign(or_query->begin(), or_query->end());
         }
     }
+    return *url_;
 }
 
 } // namespace fawkes
@@ -4,12 +4,18 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <string_view>
 
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/beast/http/field.hpp>
 #include <boost/beast/http/message.hpp>
 #include <boost/beast/http/string_body.hpp>
+#include <boost/json/value.hpp>
+#include <boost/json/value_to.hpp>
 #include <boost/url/url.hpp>
 
 #include "fawkes/cookie.hpp"
@@ -18,9 +24,13 @@
 
 namespace fawkes {
 
+namespace asio = boost::asio;
 namespace urls = boost::urls;
 namespace http = boost::beast::http;
 
+class arena;
+class body_stream;
+
 class request {
 public:
     using impl_type = http::request<http::string_body>;
@@ -30,9 +40,21 @@ public:
     // Throws `http_error` if path part of the URL is invalid.
     explicit request(impl_type&& req_impl);
 
+    // Re-initializes from a new raw request, reusing internal storage where possible.
+    // Used by the server to recycle per-connection request state across keep-alive
+    // requests.
+    // Throws `http_error` like the constructor.
+    void reset(impl_type&& req_impl);
+
     // Path part of a request target, any percent-escapes are decoded.
+    // Escape-free paths -- the common case -- are viewed in place, without a decoded
+    // copy.
     [[nodiscard]] std::string_view path() const noexcept {
-        return path_;
+        if (path_decoded_) {
+            return path_storage_;
+        }
+        const std::string_view target = impl_.target();
+        return target.substr(0, query_pos_);
     }
 
     // Request target in http request, may contain percent-escapes.
@@ -40,7 +62,13 @@ public:
     // If query string of the `as_impl().target()` contains invalid characters, `target()`
     // discards entire query string.
     [[nodiscard]] std::string_view target() const noexcept {
-        return std::string_view{url_.data(), url_.size()};
+        // Once materialized the url owns the authoritative form, including any edits
+        // made through `queries()`.
+        if (url_.has_value()) {
+            return {url_->data(), url_->size()};
+        }
+        const std::string_view target = impl_.target();
+        return query_valid_ ? target : target.substr(0, query_pos_);
     }
 
     [[nodiscard]] const path_params& params() const noexcept {
@@ -51,14 +79,16 @@ public:
         return ps_;
     }
 
-    [[nodiscard]] query_params_view queries() const noexcept {
-        const urls::params_view ps = url_.params();
-        return query_params_view(ps);
+    // Materializes the owning url on first access; requests that never touch their
+    // queries pay nothing for them.
+    [[nodiscard]] query_params_view queries() const {
+        const urls::params_view ps = url().params();
+        return {ps, url().encoded_params()};
     }
 
-    [[nodiscard]] query_params_ref queries() noexcept {
-        const urls::params_ref ps = url_.params();
-        return query_params_ref(ps);
+    [[nodiscard]] query_params_ref queries() {
+        const urls::params_ref ps = url().params();
+        return {ps, url().encoded_params()};
     }
 
     [[nodiscard]] const impl_type::header_type& header() const noexcept {
@@ -85,6 +115,64 @@ public:
         return impl_.body();
     }
 
+    // Parses the body as JSON. The returned value allocates from `arena()` when the
+    // request was produced by the server, so it must not outlive the handler.
+    // Throws `http_error` with 400 status if the body is not valid JSON.
+    [[nodiscard]] boost::json::value json() const;
+
+    // Parses the body and binds it to `T` through `boost::json::value_to`.
+    // Throws like `json()`, plus whatever the conversion to `T` throws.
+    template<typename T>
+    [[nodiscard]] T json_as() const {
+        return boost::json::value_to<T>(json());
+    }
+
+    // Peer endpoint of the connection the request arrived on; default-constructed when
+    // the request was not produced by the server, e.g. in unit tests.
+    [[nodiscard]] const asio::ip::tcp::endpoint& remote() const noexcept {
+        return remote_;
+    }
+
+    // Managed by the server; set once per connection, a handler should never call this.
+    void set_remote(const asio::ip::tcp::endpoint& remote) noexcept {
+        remote_ = remote;
+    }
+
+    // Instant at which the first octets of this request arrived; default-constructed
+    // when the request was not produced by the server.
+    [[nodiscard]] std::chrono::steady_clock::time_point received_at() const noexcept {
+        return received_at_;
+    }
+
+    // Managed by the server; set per request, a handler should never call this.
+    void set_received_at(std::chrono::steady_clock::time_point at) noexcept {
+        received_at_ = at;
+    }
+
+    // Per-session scratch allocator, rewound between keep-alive requests; non-null for
+    // every request produced by the server. Anything allocated from it must not be
+    // referenced after the handler's response completes.
+    [[nodiscard]] class arena* arena() const noexcept {
+        return arena_;
+    }
+
+    // Managed by the server; a handler should never call this.
+    void set_arena(class arena* arena) noexcept {
+        arena_ = arena;
+    }
+
+    // Incremental body reader; non-null only while serving a route registered via
+    // `router::add_stream_route()`. In that mode `body()` stays empty and the handler
+    // pulls body chunks through the reader instead.
+    [[nodiscard]] body_stream* body_reader() const noexcept {
+        return body_reader_;
+    }
+
+    // Managed by the server; a handler should never call this.
+    void set_body_reader(body_stream* reader) noexcept {
+        body_reader_ = reader;
+    }
+
     [[nodiscard]] const impl_type& as_impl() const noexcept {
         return impl_;
     }
@@ -94,10 +182,22 @@ public:
     }
 
 private:
+    void parse_target();
+
+    // Builds (once) and returns the owning url for query access.
+    [[nodiscard]] urls::url& url() const;
+
     impl_type impl_;
-    urls::url url_;
-    std::string path_; // Percent-decoded.
+    mutable std::optional<urls::url> url_; // Lazily materialized.
+    std::string path_storage_; // Percent-decoded; filled only when the path has escapes.
+    std::size_t query_pos_{std::string_view::npos};
+    bool query_valid_{true};
+    bool path_decoded_{false};
     path_params ps_;
+    asio::ip::tcp::endpoint remote_;
+    std::chrono::steady_clock::time_point received_at_;
+    class arena* arena_{nullptr};
+    body_stream* body_reader_{nullptr};
 };
 
 static_assert(std::is_nothrow_move_constructible_v<request> &&
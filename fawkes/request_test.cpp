@@ -2,11 +2,17 @@
 // This file is subject to the terms of license that can be found
 // in the LICENSE file.
 
+#include <cstdint>
+#include <map>
 #include <optional>
+#include <string>
+#include <tuple>
 #include <utility>
 
+#include <boost/json/value.hpp>
 #include <doctest/doctest.h>
 
+#include "fawkes/arena.hpp"
 #include "fawkes/errors.hpp"
 #include "fawkes/request.hpp"
 
@@ -26,6 +32,16 @@ TEST_CASE("Percent-decode path automatically") {
     }
 }
 
+TEST_CASE("Escape-free path needs no decoded copy") {
+    fawkes::request::impl_type raw_req;
+    raw_req.target("/users/42?x=1");
+    const fawkes::request req(std::move(raw_req));
+    CHECK_EQ(req.path(), "/users/42");
+    // The view aliases the target buffer instead of an internal copy.
+    CHECK_EQ(static_cast<const void*>(req.path().data()),
+             static_cast<const void*>(req.as_impl().target().data()));
+}
+
 TEST_CASE("Throws when path part is invalid") {
     fawkes::request::impl_type raw_req;
     raw_req.target("/search%GAery?foobar"); // %GA is illegal
@@ -90,6 +106,55 @@ TEST_CASE("Query parameters operations") {
     }
 }
 
+TEST_CASE("Zero-copy query reads") {
+    fawkes::request::impl_type raw_req;
+    raw_req.target("/items?id=42&name=hello%20world&page=-7");
+    const fawkes::request req(std::move(raw_req));
+
+    SUBCASE("view compares without materializing a string") {
+        const auto name = req.queries().get_view("name");
+        REQUIRE(name.has_value());
+        CHECK(*name == "hello world"); // NOLINT(bugprone-unchecked-optional-access)
+        CHECK_FALSE(req.queries().get_view("missing").has_value());
+    }
+
+    SUBCASE("typed extraction parses in place") {
+        CHECK_EQ(req.queries().get_as<std::int64_t>("id"), 42);
+        CHECK_EQ(req.queries().get_as<int>("page"), -7);
+        CHECK_FALSE(req.queries().get_as<int>("name").has_value());
+        CHECK_FALSE(req.queries().get_as<int>("missing").has_value());
+    }
+}
+
+TEST_CASE("Typed json body binding") {
+    fawkes::request::impl_type raw_req;
+    raw_req.target("/users");
+    raw_req.body() = R"({"name":"kc","age":30})";
+    fawkes::request req(std::move(raw_req));
+
+    SUBCASE("parse into a value") {
+        const auto jv = req.json();
+        CHECK_EQ(jv.at("name").as_string(), "kc");
+    }
+
+    SUBCASE("bind into a typed field") {
+        CHECK_EQ(req.json_as<std::map<std::string, boost::json::value>>().at("age").as_int64(),
+                 30);
+    }
+
+    SUBCASE("parse on the request arena") {
+        fawkes::arena arena;
+        req.set_arena(&arena);
+        const auto jv = req.json();
+        CHECK_EQ(jv.at("age").as_int64(), 30);
+    }
+
+    SUBCASE("invalid body maps to 400") {
+        req.body() = "not json";
+        CHECK_THROWS_AS(std::ignore = req.json(), fawkes::http_error);
+    }
+}
+
 TEST_SUITE_END(); // HTTP Request
 
 } // namespace
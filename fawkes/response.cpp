@@ -4,4 +4,92 @@
 
 #include "fawkes/response.hpp"
 
-namespace fawkes {} // namespace fawkes
+#include <array>
+#include <cassert>
+#include <memory>
+#include <utility>
+
+#include <boost/beast/core/file_base.hpp>
+#include <boost/json/serializer.hpp>
+#include <boost/system/error_code.hpp>
+#include <fmt/format.h>
+
+#include "fawkes/errors.hpp"
+
+namespace fawkes {
+
+namespace beast = boost::beast;
+namespace json = boost::json;
+
+void response::json(http::status status, const json::value& value) {
+    impl_.result(status);
+    impl_.set(http::field::content_type, mime::json);
+
+    // Serializers carry their own scratch state; one per io thread is reused for every
+    // response serialized on it. Output lands in `body()`, whose capacity persists
+    // across keep-alive requests.
+    static thread_local json::serializer sr;
+    sr.reset(&value);
+
+    auto& body = impl_.body();
+    body.clear();
+    std::array<char, 4096> chunk; // NOLINT(*-member-init)
+    while (!sr.done()) {
+        const auto out = sr.read(chunk.data(), chunk.size());
+        body.append(out.data(), out.size());
+    }
+}
+
+void response::set_etag(std::string_view tag) {
+    if (tag.starts_with('"') || tag.starts_with("W/")) {
+        impl_.set(http::field::etag, tag);
+    } else {
+        impl_.set(http::field::etag, fmt::format("\"{}\"", tag));
+    }
+}
+
+void response::file(http::status status, const std::string& path,
+                    std::string_view content_type) {
+    auto file = std::make_unique<http::file_body::value_type>();
+    boost::system::error_code ec;
+    file->open(path.c_str(), beast::file_mode::scan, ec);
+    if (ec) {
+        throw http_error(http::status::not_found,
+                         fmt::format("cannot open file '{}': {}", path, ec.message()));
+    }
+
+    impl_.result(status);
+    impl_.set(http::field::content_type, content_type);
+    file_ = std::move(file);
+}
+
+http::response<http::file_body> response::release_file_response() {
+    assert(has_file());
+
+    http::response<http::file_body> resp;
+    resp.base() = std::move(impl_.base());
+    resp.body() = std::move(*file_);
+    file_.reset();
+    resp.prepare_payload();
+    return resp;
+}
+
+segmented_body::value_type& response::segments() {
+    if (segments_ == nullptr) {
+        segments_ = std::make_unique<segmented_body::value_type>();
+    }
+    return *segments_;
+}
+
+http::response<segmented_body> response::release_segmented_response() {
+    assert(has_segments());
+
+    http::response<segmented_body> resp;
+    resp.base() = std::move(impl_.base());
+    resp.body() = std::move(*segments_);
+    segments_->clear();
+    resp.prepare_payload();
+    return resp;
+}
+
+} // namespace fawkes
@@ -4,24 +4,32 @@
 
 #pragma once
 
+#include <concepts>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
 
 #include <boost/beast/http/field.hpp>
+#include <boost/beast/http/file_body.hpp>
 #include <boost/beast/http/message.hpp>
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/string_body.hpp>
 #include <boost/beast/version.hpp>
+#include <boost/json/value.hpp>
+#include <boost/json/value_from.hpp>
 
 #include "fawkes/cookie.hpp"
 #include "fawkes/mime.hpp"
+#include "fawkes/segmented_body.hpp"
 
 namespace fawkes {
 
 namespace http = boost::beast::http;
 
+class response_stream;
+
 class response {
 public:
     using impl_type = http::response<http::string_body>;
@@ -36,6 +44,21 @@ public:
         impl_.keep_alive(keep_alive);
     }
 
+    // Restores a fresh state for reuse across keep-alive requests, retaining allocated
+    // storage where possible.
+    void reset(unsigned int version, bool keep_alive) {
+        impl_.base().clear();
+        impl_.body().clear();
+        impl_.result(http::status::ok);
+        impl_.version(version);
+        impl_.keep_alive(keep_alive);
+        file_.reset();
+        if (segments_ != nullptr) {
+            segments_->clear();
+        }
+        stream_writer_ = nullptr;
+    }
+
     [[nodiscard]] const impl_type::header_type& header() const noexcept {
         return impl_.base();
     }
@@ -87,6 +110,51 @@ public:
         impl_.body() = std::move(data);
     }
 
+    // Serializes `value` straight into the body buffer through a per-thread pooled
+    // serializer; no intermediate string is built.
+    void json(http::status status, const boost::json::value& value);
+
+    // Converts any type boost.json knows -- built-ins or a `tag_invoke` overload --
+    // and serializes it like the `json::value` overload.
+    // Stringish types keep hitting the raw overloads above.
+    template<typename T>
+        requires(!std::convertible_to<const T&, std::string_view> &&
+                 !std::same_as<T, boost::json::value>)
+    void json(http::status status, const T& value) {
+        json(status, boost::json::value_from(value));
+    }
+
+    // Sets the ETag header, adding the surrounding quotes unless `tag` already comes
+    // quoted or carries a `W/` weak prefix.
+    void set_etag(std::string_view tag);
+
+    // Responds with the content of the file at `path`.
+    // The file content is streamed from the kernel page cache (via sendfile when available)
+    // and never buffered in user space, thus `body()` is left untouched.
+    // Throws `http_error` with 404 status if the file cannot be opened.
+    void file(http::status status, const std::string& path, std::string_view content_type);
+
+    [[nodiscard]] bool has_file() const noexcept {
+        return file_ != nullptr;
+    }
+
+    // Moves the header and the opened file out into a file-body response.
+    // `has_file()` must be true.
+    [[nodiscard]] http::response<http::file_body> release_file_response();
+
+    // Composes the body from owned and borrowed pieces written to the socket via
+    // gather I/O; nothing is concatenated. Once any segment is added, `body()` is
+    // ignored. See `segmented_body::value_type` for the borrowing contract.
+    [[nodiscard]] segmented_body::value_type& segments();
+
+    [[nodiscard]] bool has_segments() const noexcept {
+        return segments_ != nullptr && !segments_->empty();
+    }
+
+    // Moves the header and the segments out into a segmented-body response.
+    // `has_segments()` must be true.
+    [[nodiscard]] http::response<segmented_body> release_segmented_response();
+
     void add_set_cookie(const cookie& cookie) {
         const auto value = cookie.to_string();
         if (!value.empty()) {
@@ -105,6 +173,17 @@ public:
         return impl_.body();
     }
 
+    // Incremental chunked-body writer; non-null for every request served over a plain
+    // connection. Once the handler awaits a write on it, `body()` is ignored.
+    [[nodiscard]] response_stream* stream() const noexcept {
+        return stream_writer_;
+    }
+
+    // Managed by the server; a handler should never call this.
+    void set_stream_writer(response_stream* writer) noexcept {
+        stream_writer_ = writer;
+    }
+
     [[nodiscard]] const impl_type& as_impl() const noexcept {
         return impl_;
     }
@@ -115,6 +194,12 @@ public:
 
 private:
     impl_type impl_;
+    response_stream* stream_writer_{nullptr};
+    // Held indirectly because `file_body::value_type` is not nothrow-movable.
+    std::unique_ptr<http::file_body::value_type> file_;
+    // Held indirectly to keep the response nothrow-movable; allocated on first use
+    // and recycled across keep-alive requests.
+    std::unique_ptr<segmented_body::value_type> segments_;
 };
 
 static_assert(std::is_nothrow_move_constructible_v<response> &&
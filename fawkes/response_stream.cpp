@@ -0,0 +1,114 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/response_stream.hpp"
+
+#include <cassert>
+#include <system_error>
+#include <utility>
+
+#include <boost/asio/as_tuple.hpp>
+#include <boost/beast/http/error.hpp>
+#include <boost/beast/http/write.hpp>
+#include <fmt/format.h>
+
+namespace fawkes {
+
+asio::awaitable<void> response_stream::write_header() {
+#if defined(FAWKES_ENABLE_TLS)
+    if (tls_ != nullptr) {
+        co_return co_await write_header_on(*tls_);
+    }
+#endif
+    co_await write_header_on(*stream_);
+}
+
+template<typename Stream>
+asio::awaitable<void> response_stream::write_header_on(Stream& stream) {
+    assert(resp_ != nullptr);
+    assert(!header_written_);
+
+    auto& impl = resp_->as_impl();
+    keep_alive_ = impl.keep_alive();
+    msg_.base() = std::move(impl.base());
+    msg_.chunked(true);
+    msg_.body().data = nullptr;
+    msg_.body().more = true;
+
+    sr_.emplace(msg_);
+    wire_bytes_ += co_await http::async_write_header(stream, *sr_);
+    header_written_ = true;
+}
+
+asio::awaitable<void> response_stream::write(std::string_view chunk) {
+    assert(!finished_);
+
+    if (!header_written_) {
+        co_await write_header();
+    }
+
+    if (chunk.empty()) {
+        co_return;
+    }
+
+    msg_.body().data = const_cast<char*>(chunk.data()); // NOLINT(*-const-cast)
+    msg_.body().size = chunk.size();
+    msg_.body().more = true;
+
+#if defined(FAWKES_ENABLE_TLS)
+    if (tls_ != nullptr) {
+        co_return co_await write_chunk_on(*tls_);
+    }
+#endif
+    co_await write_chunk_on(*stream_);
+}
+
+template<typename Stream>
+asio::awaitable<void> response_stream::write_chunk_on(Stream& stream) {
+    auto [ec, bytes_written] = co_await http::async_write(stream, *sr_, asio::as_tuple);
+    wire_bytes_ += bytes_written;
+
+    // `need_buffer` merely signals the chunk is fully written.
+    if (ec && ec != http::error::need_buffer) {
+        throw std::system_error(ec);
+    }
+}
+
+asio::awaitable<void> response_stream::write_event(std::string_view event,
+                                                   std::string_view data) {
+    event_buf_.clear();
+    fmt::format_to(std::back_inserter(event_buf_), "event: {}\ndata: {}\n\n", event, data);
+    co_await write(event_buf_);
+}
+
+asio::awaitable<void> response_stream::finish() {
+    if (finished_) {
+        co_return;
+    }
+
+    if (!header_written_) {
+        co_await write_header();
+    }
+
+    msg_.body().data = nullptr;
+    msg_.body().size = 0U;
+    msg_.body().more = false;
+
+#if defined(FAWKES_ENABLE_TLS)
+    if (tls_ != nullptr) {
+        co_await finish_on(*tls_);
+        finished_ = true;
+        co_return;
+    }
+#endif
+    co_await finish_on(*stream_);
+    finished_ = true;
+}
+
+template<typename Stream>
+asio::awaitable<void> response_stream::finish_on(Stream& stream) {
+    wire_bytes_ += co_await http::async_write(stream, *sr_);
+}
+
+} // namespace fawkes
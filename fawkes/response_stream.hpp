@@ -0,0 +1,120 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/http/buffer_body.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/http/serializer.hpp>
+
+#include "fawkes/response.hpp"
+#include "fawkes/tls_stream.hpp"
+
+namespace fawkes {
+
+namespace asio = boost::asio;
+namespace beast = boost::beast;
+namespace http = boost::beast::http;
+
+// Incremental writer emitting a chunked-encoded response body directly on the connection.
+// Created by the server for every request; a handler switches to streaming mode simply by
+// awaiting `write()` on `response::stream()`. Each chunk is written to the socket before
+// the awaiting coroutine resumes, so a slow client backpressures the producer instead of
+// growing an in-memory buffer.
+// Status and headers are taken from the attached `response` when the first chunk (or an
+// explicit `write_header()`) goes out; later header mutations have no effect, and
+// `response::body()` is ignored entirely.
+class response_stream {
+public:
+    explicit response_stream(beast::tcp_stream& stream)
+        : stream_(&stream) {}
+
+#if defined(FAWKES_ENABLE_TLS)
+    // Same writer over a TLS session; chunks are encrypted on their way out.
+    explicit response_stream(tls_stream& stream)
+        : tls_(&stream) {}
+#endif
+
+    ~response_stream() = default;
+
+    response_stream(const response_stream&) = delete;
+    response_stream(response_stream&&) = delete;
+    response_stream& operator=(const response_stream&) = delete;
+    response_stream& operator=(response_stream&&) = delete;
+
+    void attach(response& resp) noexcept {
+        resp_ = &resp;
+    }
+
+    // Sends status line and headers with chunked transfer encoding applied.
+    // Implicitly invoked by the first `write()`.
+    [[nodiscard]] asio::awaitable<void> write_header();
+
+    // Writes one body chunk; empty chunks are ignored as they would terminate the
+    // chunked encoding prematurely.
+    // Throws `std::system_error` on write failures.
+    [[nodiscard]] asio::awaitable<void> write(std::string_view chunk);
+
+    // Server-sent events convenience: emits an `event:`/`data:` record as one chunk.
+    // The handler should set Content-Type to `text/event-stream` before the first write.
+    [[nodiscard]] asio::awaitable<void> write_event(std::string_view event,
+                                                    std::string_view data);
+
+    // Emits the final chunk. Invoked by the server if the handler omits it.
+    [[nodiscard]] asio::awaitable<void> finish();
+
+    // True once the header went out, i.e. the handler opted into streaming.
+    [[nodiscard]] bool started() const noexcept {
+        return header_written_;
+    }
+
+    [[nodiscard]] bool finished() const noexcept {
+        return finished_;
+    }
+
+    // Meaningful only after `started()`.
+    [[nodiscard]] bool keep_alive() const noexcept {
+        return keep_alive_;
+    }
+
+    // Octets written to the transport so far -- header, chunk framing and payload --
+    // for the server's byte counters.
+    [[nodiscard]] std::uint64_t wire_bytes() const noexcept {
+        return wire_bytes_;
+    }
+
+private:
+    // The write path is generic over the transport; only the stream the serializer is
+    // driven against differs between plaintext and TLS.
+    template<typename Stream>
+    [[nodiscard]] asio::awaitable<void> write_header_on(Stream& stream);
+
+    template<typename Stream>
+    [[nodiscard]] asio::awaitable<void> write_chunk_on(Stream& stream);
+
+    template<typename Stream>
+    [[nodiscard]] asio::awaitable<void> finish_on(Stream& stream);
+
+    beast::tcp_stream* stream_{nullptr};
+#if defined(FAWKES_ENABLE_TLS)
+    tls_stream* tls_{nullptr};
+#endif
+    response* resp_{nullptr};
+    http::response<http::buffer_body> msg_;
+    std::optional<http::response_serializer<http::buffer_body>> sr_;
+    std::string event_buf_;
+    std::uint64_t wire_bytes_{0};
+    bool header_written_{false};
+    bool finished_{false};
+    bool keep_alive_{false};
+};
+
+} // namespace fawkes
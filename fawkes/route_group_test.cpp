@@ -0,0 +1,125 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <doctest/doctest.h>
+
+#include "fawkes/middleware.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+#include "fawkes/route_group.hpp"
+#include "fawkes/router.hpp"
+#include "test_utils/run_awaitable_sync.hpp"
+
+namespace {
+
+namespace asio = boost::asio;
+namespace http = boost::beast::http;
+
+struct tracer {
+    std::vector<std::string>* trace;
+    std::string mark;
+
+    fawkes::middleware_result pre_handle(fawkes::request& /*req*/,
+                                         fawkes::response& /*resp*/) const {
+        trace->push_back(mark);
+        return fawkes::middleware_result::proceed;
+    }
+};
+
+auto make_handler(std::vector<std::string>& trace, std::string mark) {
+    return [&trace, mark = std::move(mark)](const fawkes::request& /*req*/,
+                                            fawkes::response& /*resp*/)
+               -> asio::awaitable<void> {
+        trace.push_back(mark);
+        co_return;
+    };
+}
+
+TEST_SUITE_BEGIN("Route Group");
+
+TEST_CASE("Composes the prefix at registration") {
+    fawkes::router router;
+    std::vector<std::string> trace;
+
+    auto v2 = fawkes::route_group(router, "/api/v2", std::tuple<>{});
+    v2.do_get("/users/:id", make_handler(trace, "user"));
+    v2.do_post("/users", make_handler(trace, "create"));
+
+    fawkes::path_params params;
+    REQUIRE_NE(router.locate_route(http::verb::get, "/api/v2/users/42", params), nullptr);
+    CHECK_EQ(params.get("id"), "42");
+    CHECK_NE(router.locate_route(http::verb::post, "/api/v2/users", params), nullptr);
+    CHECK_EQ(router.locate_route(http::verb::get, "/users/42", params), nullptr);
+}
+
+TEST_CASE("Group middlewares are merged into the route wrapper") {
+    fawkes::router router;
+    std::vector<std::string> trace;
+
+    auto v2 = fawkes::route_group(router, "/api/v2",
+                                  std::make_tuple(tracer{&trace, "group"}));
+    v2.do_get("/ping", make_handler(trace, "ping"));
+
+    fawkes::path_params params;
+    const auto* entry = router.locate_route(http::verb::get, "/api/v2/ping", params);
+    REQUIRE_NE(entry, nullptr);
+
+    fawkes::request req;
+    fawkes::response resp;
+    asio::io_context ioc;
+    const auto result = test_util::run_awaitable_sync(ioc, (*entry)(req, resp));
+    CHECK_EQ(result, fawkes::middleware_result::proceed);
+    CHECK_EQ(trace, std::vector<std::string>{"group", "ping"});
+}
+
+TEST_CASE("Nested groups compose prefixes and middleware order") {
+    fawkes::router router;
+    std::vector<std::string> trace;
+
+    auto api = fawkes::route_group(router, "/api",
+                                   std::make_tuple(tracer{&trace, "outer"}));
+    auto v2 = api.group("/v2", std::make_tuple(tracer{&trace, "inner"}));
+    v2.do_get("/ping", std::make_tuple(tracer{&trace, "route"}),
+              make_handler(trace, "ping"));
+
+    fawkes::path_params params;
+    const auto* entry = router.locate_route(http::verb::get, "/api/v2/ping", params);
+    REQUIRE_NE(entry, nullptr);
+
+    fawkes::request req;
+    fawkes::response resp;
+    asio::io_context ioc;
+    const auto result = test_util::run_awaitable_sync(ioc, (*entry)(req, resp));
+    CHECK_EQ(result, fawkes::middleware_result::proceed);
+    CHECK_EQ(trace, (std::vector<std::string>{"outer", "inner", "route", "ping"}));
+}
+
+TEST_CASE("Rejects malformed prefixes and paths") {
+    fawkes::router router;
+
+    CHECK_THROWS_AS(fawkes::route_group(router, "api", std::tuple<>{}),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(fawkes::route_group(router, "/api/", std::tuple<>{}),
+                    std::invalid_argument);
+
+    auto api = fawkes::route_group(router, "/api", std::tuple<>{});
+    CHECK_THROWS_AS(api.do_get("ping", [](const fawkes::request& /*req*/,
+                                          fawkes::response& /*resp*/)
+                                           -> asio::awaitable<void> {
+                        co_return;
+                    }),
+                    std::invalid_argument);
+}
+
+TEST_SUITE_END(); // Route Group
+
+} // namespace
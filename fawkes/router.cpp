@@ -4,4 +4,33 @@
 
 #include "fawkes/router.hpp"
 
-namespace fawkes {} // namespace fawkes
+#include <utility>
+
+namespace fawkes {
+
+void router::compile() {
+    if (compiled_) {
+        return;
+    }
+
+    compiled_routes_.reserve(routes_.size());
+    for (auto& [verb, tree] : routes_) {
+        compiled_routes_.insert_or_assign(verb, compiled_tree{std::move(tree)});
+    }
+    routes_.clear();
+    compiled_ = true;
+
+    // Resolve the recorded static paths against the compiled trees; entry storage is
+    // stable from here on.
+    path_params ps;
+    for (const auto& [verb, path] : static_paths_) {
+        if (const auto* entry = locate_route(verb, path, ps); entry != nullptr) {
+            static_routes_[verb].insert_or_assign(path, entry);
+        }
+        ps.clear();
+    }
+    static_paths_.clear();
+    static_paths_.shrink_to_fit();
+}
+
+} // namespace fawkes
@@ -6,16 +6,20 @@
 
 #include <concepts>
 #include <exception>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <boost/asio/awaitable.hpp>
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/verb.hpp>
 #include <boost/json/object.hpp>
 #include <boost/json/serialize.hpp>
+#include <boost/container_hash/hash.hpp>
 #include <boost/unordered/unordered_flat_map.hpp>
 
 #include "fawkes/errors.hpp"
@@ -26,11 +30,57 @@
 
 namespace fawkes {
 
+namespace detail {
+
+struct route_path_hash {
+    using is_transparent = void;
+
+    [[nodiscard]] std::size_t operator()(std::string_view path) const noexcept {
+        return boost::hash<std::string_view>{}(path);
+    }
+};
+
+// Renders the in-flight exception of a user handler into an error response; exceptions
+// not derived from std::exception propagate.
+// Must be called from within a catch block.
+inline void render_handler_error(response& resp) {
+    try {
+        throw;
+    } catch (const http_error& ex) {
+        boost::json::object err{{"message", ex.what()}};
+        if (const auto& ec = ex.error_code(); ec.has_value()) {
+            err["code"] = *ec;
+        }
+        const boost::json::object body{{"error", std::move(err)}};
+        resp.json(ex.status_code(), boost::json::serialize(body));
+    } catch (const std::exception& ex) {
+        const boost::json::object body{{"error", boost::json::object{{"message", ex.what()}}}};
+        resp.json(boost::beast::http::status::internal_server_error,
+                  boost::json::serialize(body));
+    }
+}
+
+// Fully-static paths resolved against the compiled tree; a single hash probe replaces
+// the multi-node tree descent for them.
+using static_route_map =
+    boost::unordered_flat_map<std::string, const route_entry*, route_path_hash, std::equal_to<>>;
+
+} // namespace detail
+
 namespace asio = boost::asio;
 namespace beast = boost::beast;
 namespace http = boost::beast::http;
 namespace json = boost::json;
 
+// A type-erased, allocation-free lookup delegate; see `static_router::locator()`.
+struct route_locator {
+    const void* table{nullptr};
+    const route_entry* (*locate)(const void*,
+                                 beast::http::verb,
+                                 std::string_view,
+                                 path_params&){nullptr};
+};
+
 template<typename F>
 concept is_user_handler = std::movable<std::decay_t<F>> &&
                           std::invocable<F, const request&, response&> &&
@@ -38,8 +88,25 @@ concept is_user_handler = std::movable<std::decay_t<F>> &&
                               std::invoke_result_t<F, const request&, response&>,
                               void>;
 
+template<typename F>
+concept is_ws_handler = std::movable<std::decay_t<F>> &&
+                        std::invocable<F, const request&, ws_session&> &&
+                        is_asio_awaitable_of_v<
+                            std::invoke_result_t<F, const request&, ws_session&>,
+                            void>;
+
 class router {
 public:
+    // Freezes each verb's radix tree into a contiguous node array (`compiled_tree`),
+    // making lookups walk offsets instead of per-node heap pointers.
+    // Routes are fixed once compiled; registering afterwards throws `std::logic_error`.
+    // Calling `compile()` more than once is a no-op.
+    void compile();
+
+    [[nodiscard]] bool compiled() const noexcept {
+        return compiled_;
+    }
+
     // Throws `std::invalid_argument` if there is path conflict.
     template<is_user_handler H>
     void add_route(beast::http::verb verb, std::string_view path, H&& handler) {
@@ -52,6 +119,87 @@ public:
                    std::string_view path,
                    std::tuple<Mws...>&& middlewares,
                    H&& handler) {
+        do_add_route(verb, path, std::move(middlewares), std::forward<H>(handler), false);
+    }
+
+    // Registers a route whose request body is not buffered before dispatch: the handler
+    // pulls body chunks through `request::body_reader()` after the header arrives.
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_user_handler H>
+    void add_stream_route(beast::http::verb verb, std::string_view path, H&& handler) {
+        add_stream_route(verb, path, {}, std::forward<H>(handler));
+    }
+
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_user_handler H, is_middleware... Mws>
+    void add_stream_route(beast::http::verb verb,
+                          std::string_view path,
+                          std::tuple<Mws...>&& middlewares,
+                          H&& handler) {
+        do_add_route(verb, path, std::move(middlewares), std::forward<H>(handler), true);
+    }
+
+    [[nodiscard]] bool has_stream_routes() const noexcept {
+        return has_stream_routes_;
+    }
+
+    // Registers a WebSocket route under GET `path`: on a matching Upgrade request the
+    // server completes the handshake and hands the session to `handler`; the connection
+    // belongs to the handler from then on. Non-upgrade requests to the path answer 426.
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_ws_handler H>
+    void add_ws_route(std::string_view path, H&& handler) {
+        if (compiled_) [[unlikely]] {
+            throw std::logic_error("cannot register routes on a compiled router");
+        }
+
+        routes_[beast::http::verb::get].add_route(
+            path, route_entry{.ws = ws_handler_t{std::forward<H>(handler)}});
+        has_ws_routes_ = true;
+        if (!detail::find_wildcard(path).found()) {
+            static_paths_.emplace_back(beast::http::verb::get, std::string{path});
+        }
+    }
+
+    [[nodiscard]] bool has_ws_routes() const noexcept {
+        return has_ws_routes_;
+    }
+
+    // Registers a conditional route: before dispatch the server calls `validator` for
+    // the current entity tag and answers a matching If-None-Match with a header-only
+    // 304, never invoking the handler. On a miss the tag is pre-set on the response.
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_user_handler H>
+    void add_conditional_route(beast::http::verb verb,
+                               std::string_view path,
+                               etag_validator_t validator,
+                               H&& handler) {
+        add_conditional_route(verb, path, {}, std::move(validator), std::forward<H>(handler));
+    }
+
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_user_handler H, is_middleware... Mws>
+    void add_conditional_route(beast::http::verb verb,
+                               std::string_view path,
+                               std::tuple<Mws...>&& middlewares,
+                               etag_validator_t validator,
+                               H&& handler) {
+        do_add_route(verb, path, std::move(middlewares), std::forward<H>(handler), false,
+                     std::move(validator));
+    }
+
+private:
+    template<is_user_handler H, is_middleware... Mws>
+    void do_add_route(beast::http::verb verb,
+                      std::string_view path,
+                      std::tuple<Mws...>&& middlewares,
+                      H&& handler,
+                      bool streams_body,
+                      etag_validator_t etag_validator = {}) {
+        if (compiled_) [[unlikely]] {
+            throw std::logic_error("cannot register routes on a compiled router");
+        }
+
         auto hd = []<typename T>(T&& value) -> std::decay_t<T> { // NOLINT(*-missing-std-forward)
             if constexpr (std::is_lvalue_reference_v<T>) {
                 return value;
@@ -60,6 +208,19 @@ public:
             }
         }((std::forward<H>(handler)));
 
+        // Without per-route middlewares the wrapper coroutine below buys nothing; store
+        // the user handler as-is and let the dispatcher await its awaitable directly.
+        if constexpr (sizeof...(Mws) == 0) {
+            routes_[verb].add_route(path, route_entry{.direct = std::move(hd),
+                                                      .streams_body = streams_body,
+                                                      .etag = std::move(etag_validator)});
+            has_stream_routes_ = has_stream_routes_ || streams_body;
+            if (!detail::find_wildcard(path).found()) {
+                static_paths_.emplace_back(verb, std::string{path});
+            }
+            return;
+        }
+
         // The lambda coroutine is stored and kept alive in routes.
         route_handler_t route_handler =
             [mws = std::move(middlewares), // NOLINT(*-avoid-capturing-lambda-coroutines)
@@ -71,32 +232,71 @@ public:
             // router-level middlewares.
             // However, throwing from any middleware would be like aborting from the middleware.
 
-            if (co_await detail::run_middlewares_pre_handle(mws, req, resp) == abort) {
-                co_return abort;
+            // All-synchronous chains fold into plain calls with no nested frame.
+            if constexpr (all_sync_middlewares<Mws...>) {
+                if (detail::run_sync_middlewares_pre_handle(mws, req, resp) == abort) {
+                    co_return abort;
+                }
+            } else {
+                if (co_await detail::run_middlewares_pre_handle(mws, req, resp) == abort) {
+                    co_return abort;
+                }
             }
 
             try {
                 co_await user_handler(std::as_const(req), resp);
-            } catch (const http_error& ex) {
-                json::object err{{"message", ex.what()}};
-                if (const auto& ec = ex.error_code(); ec.has_value()) {
-                    err["code"] = *ec;
-                }
-                const json::object body{{"error", std::move(err)}};
-                resp.json(ex.status_code(), json::serialize(body));
-            } catch (const std::exception& ex) {
-                const json::object body{{"error", json::object{{"message", ex.what()}}}};
-                resp.json(http::status::internal_server_error, json::serialize(body));
+            } catch (...) {
+                detail::render_handler_error(resp);
             }
 
-            co_return co_await detail::run_middlewares_post_handle(mws, req, resp);
+            if constexpr (all_sync_middlewares<Mws...>) {
+                co_return detail::run_sync_middlewares_post_handle(mws, req, resp);
+            } else {
+                co_return co_await detail::run_middlewares_post_handle(mws, req, resp);
+            }
         };
-        routes_[verb].add_route(path, std::move(route_handler));
+        routes_[verb].add_route(path, route_entry{.handler = std::move(route_handler),
+                                                  .streams_body = streams_body,
+                                                  .etag = std::move(etag_validator)});
+        has_stream_routes_ = has_stream_routes_ || streams_body;
+        if (!detail::find_wildcard(path).found()) {
+            static_paths_.emplace_back(verb, std::string{path});
+        }
+    }
+
+public:
+    // Delegates lookups to an externally owned compile-time route table, which must
+    // outlive the router. Runtime-registered routes are still consulted on a miss.
+    void set_locator(route_locator locator) noexcept {
+        locator_ = locator;
     }
 
     // `path` must outlive `ps`.
-    const route_handler_t* locate_route(beast::http::verb verb, std::string_view path,
-                                        path_params& ps) const {
+    const route_entry* locate_route(beast::http::verb verb, std::string_view path,
+                                    path_params& ps) const {
+        if (locator_.table != nullptr) {
+            if (const auto* entry = locator_.locate(locator_.table, verb, path, ps);
+                entry != nullptr) {
+                return entry;
+            }
+        }
+
+        if (compiled_) {
+            // Most traffic hits static routes; try the exact-match cache first.
+            if (const auto map_it = static_routes_.find(verb); map_it != static_routes_.end()) {
+                if (const auto it = map_it->second.find(path); it != map_it->second.end()) {
+                    return it->second;
+                }
+            }
+
+            const auto tree_it = compiled_routes_.find(verb);
+            if (tree_it == compiled_routes_.end()) {
+                return nullptr;
+            }
+
+            return tree_it->second.locate(path, ps);
+        }
+
         const auto tree_it = routes_.find(verb);
         if (tree_it == routes_.end()) {
             return nullptr;
@@ -111,6 +311,20 @@ public:
         base_middlewares_.set(std::make_tuple(std::move(mws)...));
     }
 
+    // True when every router-level middleware handles synchronously (or none is set);
+    // the `_sync` variants below may then be called instead of awaiting.
+    [[nodiscard]] bool middlewares_synchronous() const noexcept {
+        return base_middlewares_.synchronous();
+    }
+
+    middleware_result run_pre_handle_sync(request& req, response& resp) const {
+        return base_middlewares_.pre_handle_sync(req, resp);
+    }
+
+    middleware_result run_post_handle_sync(request& req, response& resp) const {
+        return base_middlewares_.post_handle_sync(req, resp);
+    }
+
     [[nodiscard]] asio::awaitable<middleware_result> run_pre_handle(request& req,
                                                                     response& resp) const {
         return base_middlewares_.pre_handle(req, resp);
@@ -123,7 +337,14 @@ public:
 
 private:
     boost::unordered_flat_map<beast::http::verb, node> routes_;
+    boost::unordered_flat_map<beast::http::verb, compiled_tree> compiled_routes_;
+    std::vector<std::pair<beast::http::verb, std::string>> static_paths_;
+    boost::unordered_flat_map<beast::http::verb, detail::static_route_map> static_routes_;
+    route_locator locator_;
     middleware_chain base_middlewares_;
+    bool has_stream_routes_{false};
+    bool has_ws_routes_{false};
+    bool compiled_{false};
 };
 
 } // namespace fawkes
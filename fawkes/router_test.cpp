@@ -2,6 +2,7 @@
 // This file is subject to the terms of license that can be found
 // in the LICENSE file.
 
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -15,6 +16,7 @@
 #include "fawkes/request.hpp"
 #include "fawkes/response.hpp"
 #include "fawkes/router.hpp"
+#include "fawkes/ws_session.hpp"
 #include "test_utils/run_awaitable_sync.hpp"
 
 namespace {
@@ -44,6 +46,73 @@ TEST_CASE("Concept is_user_handler") {
     }
 }
 
+TEST_CASE("Compile freezes the routes") {
+    fawkes::router router;
+    router.add_route(boost::beast::http::verb::get, "/users/:id",
+                     [](const fawkes::request& /*req*/, fawkes::response& /*resp*/)
+                         -> asio::awaitable<void> {
+                         co_return;
+                     });
+
+    router.compile();
+    CHECK(router.compiled());
+
+    fawkes::path_params params;
+    CHECK_NE(router.locate_route(boost::beast::http::verb::get, "/users/42", params), nullptr);
+    CHECK_EQ(params.get("id"), "42");
+    CHECK_EQ(router.locate_route(boost::beast::http::verb::get, "/groups", params), nullptr);
+    CHECK_EQ(router.locate_route(boost::beast::http::verb::post, "/users/42", params), nullptr);
+
+    CHECK_THROWS_AS(router.add_route(boost::beast::http::verb::get, "/groups",
+                                     [](const fawkes::request& /*req*/,
+                                        fawkes::response& /*resp*/) -> asio::awaitable<void> {
+                                         co_return;
+                                     }),
+                    std::logic_error);
+}
+
+TEST_CASE("Conditional routes carry their validator") {
+    fawkes::router router;
+    router.add_conditional_route(
+        boost::beast::http::verb::get, "/catalog",
+        [](const fawkes::request& /*req*/) { return std::string{"v42"}; },
+        [](const fawkes::request& /*req*/, fawkes::response& /*resp*/)
+            -> asio::awaitable<void> {
+            co_return;
+        });
+    router.compile();
+
+    fawkes::path_params params;
+    const auto* entry =
+        router.locate_route(boost::beast::http::verb::get, "/catalog", params);
+    REQUIRE_NE(entry, nullptr);
+    REQUIRE(static_cast<bool>(entry->etag));
+
+    fawkes::request req;
+    CHECK_EQ(entry->etag(req), "v42");
+}
+
+TEST_CASE("WebSocket routes carry their handler") {
+    fawkes::router router;
+    router.add_ws_route("/feed/:topic",
+                        [](const fawkes::request& /*req*/, fawkes::ws_session& /*session*/)
+                            -> asio::awaitable<void> {
+                            co_return;
+                        });
+    CHECK(router.has_ws_routes());
+
+    router.compile();
+
+    fawkes::path_params params;
+    const auto* entry =
+        router.locate_route(boost::beast::http::verb::get, "/feed/news", params);
+    REQUIRE_NE(entry, nullptr);
+    CHECK(static_cast<bool>(entry->ws));
+    CHECK_FALSE(static_cast<bool>(entry->handler));
+    CHECK_FALSE(static_cast<bool>(entry->direct));
+    CHECK_EQ(params.get("topic"), "news");
+}
+
 TEST_SUITE_END(); // Routes
 
 TEST_SUITE_BEGIN("Middleware");
@@ -226,6 +295,36 @@ TEST_CASE("Middleware_chain with only pre handle") {
     CHECK_EQ(post_cnt, 0);
 }
 
+TEST_CASE("All-synchronous chain runs without the coroutine path") {
+    fawkes::middleware_chain mc;
+    CHECK(mc.synchronous());
+
+    int pre_cnt = 0;
+    int post_cnt = 0;
+    mc.set(fawkes::middlewares::use(m_count_both_t{&pre_cnt, &post_cnt},
+                                    m_count_both_t{&pre_cnt, &post_cnt}));
+    REQUIRE(mc.synchronous());
+
+    fawkes::request req;
+    fawkes::response resp;
+    CHECK_EQ(mc.pre_handle_sync(req, resp), fawkes::middleware_result::proceed);
+    CHECK_EQ(pre_cnt, 2);
+    CHECK_EQ(mc.post_handle_sync(req, resp), fawkes::middleware_result::proceed);
+    CHECK_EQ(post_cnt, 2);
+
+    SUBCASE("sync abort short-circuits") {
+        mc.set(fawkes::middlewares::use(m_abort_pre_t{}, m_count_pre_t{&pre_cnt}));
+        REQUIRE(mc.synchronous());
+        CHECK_EQ(mc.pre_handle_sync(req, resp), fawkes::middleware_result::abort);
+        CHECK_EQ(pre_cnt, 2);
+    }
+
+    SUBCASE("coroutine middleware falls back to the awaitable path") {
+        mc.set(fawkes::middlewares::use(m_coro_append_t{"x"}, m_count_pre_t{&pre_cnt}));
+        CHECK_FALSE(mc.synchronous());
+    }
+}
+
 TEST_CASE("Middleware_chain with only post handle") {
     asio::io_context ioc;
 
@@ -0,0 +1,128 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace fawkes {
+
+namespace http = boost::beast::http;
+
+// A beast body whose value is a sequence of segments, each either owned by the body
+// or borrowed from the caller. The writer hands all segments to the serializer as one
+// buffer sequence, so composed bodies -- an envelope around a cached fragment, rows of
+// a report -- go to the socket via gather I/O without ever being concatenated.
+// Borrowed segments must stay valid until the response has been fully written.
+struct segmented_body {
+    class value_type {
+    public:
+        // Takes ownership of `data`.
+        void append(std::string&& data) {
+            total_size_ += data.size();
+            segments_.push_back(std::move(data));
+        }
+
+        // References `data` without copying; the caller guarantees it outlives the
+        // write. Process-lifetime caches qualify, and so does anything allocated from
+        // the request arena, which is rewound only after the response drains.
+        void borrow(std::string_view data) {
+            total_size_ += data.size();
+            segments_.push_back(data);
+        }
+
+        // Pins `owner` until the body is cleared, extending the borrowing contract to
+        // ref-counted storage: a segment may reference bytes held by `owner` even if
+        // the owner's cache evicts it while the response is still draining.
+        void retain(std::shared_ptr<const void> owner) {
+            owners_.push_back(std::move(owner));
+        }
+
+        [[nodiscard]] std::size_t count() const noexcept {
+            return segments_.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return segments_.empty();
+        }
+
+        // Total payload size in bytes across all segments.
+        [[nodiscard]] std::uint64_t payload_size() const noexcept {
+            return total_size_;
+        }
+
+        void clear() noexcept {
+            segments_.clear();
+            owners_.clear();
+            total_size_ = 0;
+        }
+
+    private:
+        friend struct segmented_body;
+
+        using segment = std::variant<std::string, std::string_view>;
+
+        static constexpr std::size_t inline_segments = 4;
+        boost::container::small_vector<segment, inline_segments> segments_;
+        boost::container::small_vector<std::shared_ptr<const void>, 1> owners_;
+        std::uint64_t total_size_{0};
+    };
+
+    static std::uint64_t size(const value_type& body) noexcept {
+        return body.payload_size();
+    }
+
+    class writer {
+    public:
+        using const_buffers_type =
+            boost::container::small_vector<boost::asio::const_buffer,
+                                           value_type::inline_segments>;
+
+        template<bool IsRequest, typename Fields>
+        writer(const http::header<IsRequest, Fields>&, const value_type& body)
+            : body_(body) {}
+
+        void init(boost::system::error_code& ec) noexcept {
+            ec = {};
+        }
+
+        // Emits every segment in one shot; beast serializes them together with the
+        // header in a single gather write.
+        boost::optional<std::pair<const_buffers_type, bool>>
+        get(boost::system::error_code& ec) {
+            ec = {};
+            if (done_ || body_.empty()) {
+                return boost::none;
+            }
+            done_ = true;
+
+            const_buffers_type buffers;
+            buffers.reserve(body_.segments_.size());
+            for (const auto& seg : body_.segments_) {
+                const auto view = std::visit(
+                    [](const auto& data) { return std::string_view{data}; }, seg);
+                buffers.push_back(boost::asio::buffer(view.data(), view.size()));
+            }
+            return std::pair{std::move(buffers), false};
+        }
+
+    private:
+        const value_type& body_; // NOLINT(*-avoid-const-or-ref-data-members)
+        bool done_{false};
+    };
+};
+
+} // namespace fawkes
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <string>
+#include <string_view>
+
+#include <boost/beast/http/message.hpp>
+#include <boost/system/error_code.hpp>
+#include <doctest/doctest.h>
+
+#include "fawkes/response.hpp"
+#include "fawkes/segmented_body.hpp"
+
+namespace {
+
+namespace http = fawkes::http;
+
+TEST_SUITE_BEGIN("Segmented Body");
+
+TEST_CASE("Gathers owned and borrowed segments without concatenating") {
+    static constexpr std::string_view cached_fragment = "[1,2,3]";
+
+    http::response<fawkes::segmented_body> resp;
+    auto& body = resp.body();
+    body.append(std::string{R"({"data":)"});
+    body.borrow(cached_fragment);
+    body.append(std::string{"}"});
+
+    CHECK_EQ(body.count(), 3);
+    CHECK_EQ(body.payload_size(), 16);
+
+    fawkes::segmented_body::writer writer(resp.base(), body);
+    boost::system::error_code ec;
+    writer.init(ec);
+    REQUIRE_FALSE(ec);
+
+    const auto buffers = writer.get(ec);
+    REQUIRE_FALSE(ec);
+    REQUIRE(buffers.has_value());
+    // All segments arrive in one pass, i.e. one gather write.
+    CHECK_FALSE(buffers->second);
+
+    std::string assembled;
+    for (const auto buf : buffers->first) {
+        assembled.append(static_cast<const char*>(buf.data()), buf.size());
+    }
+    CHECK_EQ(assembled, R"({"data":[1,2,3]})");
+
+    // The borrowed segment references the cache; no byte was copied.
+    CHECK_EQ(buffers->first[1].data(), static_cast<const void*>(cached_fragment.data()));
+
+    CHECK_FALSE(writer.get(ec).has_value());
+}
+
+TEST_CASE("Release into a sized segmented response") {
+    fawkes::response resp;
+    resp.segments().append(std::string{"hello "});
+    resp.segments().borrow("world");
+    REQUIRE(resp.has_segments());
+
+    const auto released = resp.release_segmented_response();
+    CHECK_EQ(released[http::field::content_length], "11");
+
+    // The body moved out; the response is reusable after reset.
+    resp.reset(11, true);
+    CHECK_FALSE(resp.has_segments());
+}
+
+TEST_SUITE_END(); // Segmented Body
+
+} // namespace
@@ -5,10 +5,14 @@
 #include "fawkes/server.hpp"
 
 #include <chrono>
+#include <cstdint>
+#include <ctime>
 #include <exception>
 #include <functional>
+#include <iterator>
 #include <source_location>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <boost/asio/as_tuple.hpp>
@@ -18,7 +22,10 @@
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/deferred.hpp>
 #include <boost/asio/detached.hpp>
+#include <boost/asio/detail/socket_option.hpp>
+#include <boost/asio/experimental/awaitable_operators.hpp>
 #include <boost/asio/error.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/beast/core.hpp>
 #include <boost/beast/core/error.hpp>
 #include <boost/beast/core/string.hpp>
@@ -31,17 +38,38 @@
 #include <boost/beast/http/string_body.hpp>
 #include <boost/beast/http/write.hpp>
 #include <boost/beast/version.hpp>
+#include <boost/beast/websocket/rfc6455.hpp>
+#include <boost/beast/websocket/stream.hpp>
 #include <boost/json/object.hpp>
 #include <boost/json/serialize.hpp>
 #include <boost/system/system_error.hpp>
+
+#if defined(FAWKES_ENABLE_TLS)
+#include <boost/asio/ssl.hpp>
+#include <openssl/ssl.h>
+#endif
+
 #include <esl/ignore_unused.h>
+#include <esl/strings.h>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
 #include <fmt/ostream.h>
 #include <spdlog/spdlog.h>
 
+#include "fawkes/arena.hpp"
+#include "fawkes/body_stream.hpp"
+#include "fawkes/buffer_pool.hpp"
+#include "fawkes/canned_response.hpp"
 #include "fawkes/middleware.hpp"
 #include "fawkes/mime.hpp"
 #include "fawkes/request.hpp"
 #include "fawkes/response.hpp"
+#include "fawkes/response_stream.hpp"
+#include "fawkes/session_registry.hpp"
+#include "fawkes/timing_wheel.hpp"
+#include "fawkes/tls_stream.hpp"
+#include "fawkes/trace.hpp"
+#include "fawkes/ws_session.hpp"
 
 namespace fawkes {
 
@@ -51,6 +79,39 @@ namespace {
 
 constexpr std::string_view expect_value = "100-continue";
 
+constexpr std::string_view server_token = "fawkes";
+
+// RFC 9110 wants a Date header on every response, and rendering the IMF-fixdate
+// string costs a gmtime plus a format. Each io thread caches the rendered value and
+// refreshes it on use when the wall-clock second changes; checking on use keeps the
+// cache exact without running a timer.
+std::string_view cached_date_value() {
+    struct date_cache {
+        std::time_t rendered_at{-1};
+        fmt::basic_memory_buffer<char, 32> value;
+    };
+    static thread_local date_cache cache;
+
+    const std::time_t now = std::time(nullptr);
+    if (now != cache.rendered_at) {
+        cache.rendered_at = now;
+        cache.value.clear();
+        fmt::format_to(std::back_inserter(cache.value), "{:%a, %d %b %Y %H:%M:%S} GMT",
+                       fmt::gmtime(now));
+    }
+    return {cache.value.data(), cache.value.size()};
+}
+
+// Fills Date and Server unless the handler already set them.
+void set_shared_headers(http::fields& fields) {
+    if (fields.count(http::field::server) == 0) {
+        fields.set(http::field::server, server_token);
+    }
+    if (fields.count(http::field::date) == 0) {
+        fields.set(http::field::date, cached_date_value());
+    }
+}
+
 template<typename F>
 auto make_no_fail(F&& fn, std::source_location loc = std::source_location::current()) {
     return [f = std::forward<F>(fn), loc]() noexcept {
@@ -70,6 +131,7 @@ http::response<http::string_body> make_unexpected_error_response(unsigned int ht
                                                                  bool keep_alive,
                                                                  std::string&& body) {
     http::response<http::string_body> resp{http::status::internal_server_error, http_version};
+    set_shared_headers(resp.base());
     resp.set(http::field::content_type, mime::json);
     resp.keep_alive(keep_alive);
     resp.body() = std::move(body);
@@ -77,7 +139,76 @@ http::response<http::string_body> make_unexpected_error_response(unsigned int ht
     return resp;
 }
 
-response::impl_type&& prepare_response(response& resp) {
+// Balances a counter on every exit path of a serve coroutine, exceptional included.
+template<typename Count>
+struct count_guard {
+    Count& count; // NOLINT(*-avoid-const-or-ref-data-members)
+
+    ~count_guard() {
+        if constexpr (std::is_arithmetic_v<Count>) {
+            --count;
+        } else {
+            count.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Unlinks a session from the drain registry on every exit path of its coroutine.
+struct unlink_guard {
+    session_registry& registry; // NOLINT(*-avoid-const-or-ref-data-members)
+    session_registry::node& nd; // NOLINT(*-avoid-const-or-ref-data-members)
+
+    ~unlink_guard() {
+        registry.unlink(nd);
+    }
+};
+
+// Weak comparison per RFC 9110: `W/` prefixes and surrounding quotes are ignored on
+// both sides, and `*` matches any current tag. `if_none_match` is the raw header
+// value, possibly a comma-separated list.
+bool etag_matches(std::string_view if_none_match, std::string_view tag) noexcept {
+    if (if_none_match.empty()) {
+        return false;
+    }
+
+    constexpr auto normalize = [](std::string_view etag) noexcept {
+        if (etag.starts_with("W/")) {
+            etag.remove_prefix(2);
+        }
+        if (etag.size() >= 2 && etag.front() == '"' && etag.back() == '"') {
+            etag = etag.substr(1, etag.size() - 2);
+        }
+        return etag;
+    };
+
+    const auto wanted = normalize(tag);
+    for (std::size_t pos = 0; pos <= if_none_match.size();) {
+        auto sep = if_none_match.find(',', pos);
+        if (sep == std::string_view::npos) {
+            sep = if_none_match.size();
+        }
+        const auto candidate =
+            esl::strings::trim(if_none_match.substr(pos, sep - pos), " \t");
+        if (candidate == "*" || normalize(candidate) == wanted) {
+            return true;
+        }
+        pos = sep + 1;
+    }
+    return false;
+}
+
+http::message_generator prepare_response(response& resp) {
+    set_shared_headers(resp.header());
+
+    // File and segmented responses carry different body types; `message_generator`
+    // erases the difference.
+    if (resp.has_file()) {
+        return resp.release_file_response();
+    }
+    if (resp.has_segments()) {
+        return resp.release_segmented_response();
+    }
+
     auto& impl = resp.as_impl();
     impl.prepare_payload();
     return std::move(impl);
@@ -95,26 +226,207 @@ void set_body_limit(http::request_parser<http::string_body>& parser, const serve
     }
 }
 
+#if defined(SO_REUSEPORT)
+using reuse_port_option = asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
+#if defined(TCP_DEFER_ACCEPT)
+using defer_accept_option = asio::detail::socket_option::integer<IPPROTO_TCP, TCP_DEFER_ACCEPT>;
+#endif
+
+#if defined(TCP_FASTOPEN)
+using fastopen_option = asio::detail::socket_option::integer<IPPROTO_TCP, TCP_FASTOPEN>;
+#endif
+
+void open_listener(asio::ip::tcp::acceptor& acceptor,
+                   const asio::ip::tcp::endpoint& endpoint,
+                   const server::options& opts,
+                   bool reuse_port) {
+    acceptor.open(endpoint.protocol());
+    acceptor.set_option(asio::ip::tcp::acceptor::reuse_address{true});
+#if defined(SO_REUSEPORT)
+    if (reuse_port) {
+        acceptor.set_option(reuse_port_option{true});
+    }
+#else
+    esl::ignore_unused(reuse_port);
+#endif
+
+#if defined(TCP_DEFER_ACCEPT)
+    if (opts.tcp_defer_accept.count() > 0) {
+        acceptor.set_option(defer_accept_option{static_cast<int>(opts.tcp_defer_accept.count())});
+    }
+#endif
+
+#if defined(TCP_FASTOPEN)
+    if (opts.tcp_fastopen_queue > 0) {
+        acceptor.set_option(fastopen_option{opts.tcp_fastopen_queue});
+    }
+#endif
+
+    acceptor.bind(endpoint);
+    acceptor.listen(opts.listen_backlog > 0 ? opts.listen_backlog
+                                            : asio::socket_base::max_listen_connections);
+}
+
+// Failures are logged rather than propagated; a badly tuned socket is still servable.
+void tune_socket(asio::ip::tcp::socket& sock, const server::options& opts) {
+    [[maybe_unused]] boost::system::error_code ec;
+    if (opts.tcp_no_delay) {
+        sock.set_option(asio::ip::tcp::no_delay{true}, ec);
+    }
+    if (opts.send_buffer_size > 0) {
+        sock.set_option(asio::socket_base::send_buffer_size{opts.send_buffer_size}, ec);
+    }
+    if (opts.receive_buffer_size > 0) {
+        sock.set_option(asio::socket_base::receive_buffer_size{opts.receive_buffer_size}, ec);
+    }
+    if (ec) {
+        SPDLOG_WARN("Failed to tune accepted socket; ec={}", fmt::streamed(ec));
+    }
+}
+
+// Plaintext teardown shuts the socket down right away; TLS first exchanges
+// close_notify so the peer can tell an orderly end from truncation.
+asio::awaitable<void> shutdown_stream(beast::tcp_stream& stream) {
+    stream.socket().shutdown(asio::ip::tcp::socket::shutdown_both);
+    co_return;
+}
+
+#if defined(FAWKES_ENABLE_TLS)
+// ALPN selection for TLS clients. HTTP/2 needs a framing and HPACK layer that beast
+// does not provide, so only http/1.1 is offered for now; once an h2 engine exists,
+// this callback is where its protocol is added and the post-handshake dispatch in
+// `serve_tls_session()` forks off an h2 session.
+int select_alpn_protocol(SSL* /*ssl*/,
+                         const unsigned char** out,
+                         unsigned char* out_len,
+                         const unsigned char* in,
+                         unsigned int in_len,
+                         void* /*arg*/) {
+    static constexpr unsigned char protocols[] = {8, 'h', 't', 't', 'p', '/', '1', '.', '1'};
+    unsigned char* selected = nullptr;
+    if (SSL_select_next_proto(&selected, out_len, protocols, sizeof(protocols), in, in_len) !=
+        OPENSSL_NPN_NEGOTIATED) {
+        // No overlap; RFC 7301 wants the handshake to proceed without ALPN.
+        return SSL_TLSEXT_ERR_NOACK;
+    }
+    *out = selected;
+    return SSL_TLSEXT_ERR_OK;
+}
+
+asio::awaitable<void> shutdown_stream(tls_stream& stream) {
+    // Best effort: the peer may have slammed the connection shut already.
+    auto [ec] = co_await stream.async_shutdown(asio::as_tuple);
+    esl::ignore_unused(ec);
+    [[maybe_unused]] boost::system::error_code sd_ec;
+    beast::get_lowest_layer(stream).socket().shutdown(asio::ip::tcp::socket::shutdown_both,
+                                                      sd_ec);
+}
+#endif
+
 } // namespace
 
 void server::listen_and_serve(const std::string& addr, std::uint16_t port) {
     const auto endpoint = asio::ip::tcp::endpoint(asio::ip::make_address(addr), port);
 
-    acceptor_.open(endpoint.protocol());
-    acceptor_.set_option(asio::ip::tcp::acceptor::reuse_address{true});
-    acceptor_.bind(endpoint);
-    acceptor_.listen(asio::socket_base::max_listen_connections);
+#if defined(SO_REUSEPORT)
+    if (io_pool_ && opts_.reuse_port) {
+        pool_acceptors_.reserve(io_pool_->size());
+        for (std::size_t i = 0; i < io_pool_->size(); ++i) {
+            auto executor = io_pool_->get_executor_at(i);
+            auto& acceptor = pool_acceptors_.emplace_back(executor);
+            open_listener(acceptor, endpoint, opts_, true);
+            asio::co_spawn(executor, do_listen_local(acceptor), asio::detached);
+        }
+        return;
+    }
+#else
+    if (opts_.reuse_port) {
+        SPDLOG_WARN("SO_REUSEPORT is not supported; fall back to single-acceptor mode");
+    }
+#endif
+
+    open_listener(acceptor_, endpoint, opts_, false);
     asio::co_spawn(io_ctx_, do_listen(), asio::detached);
 }
 
+#if defined(FAWKES_ENABLE_TLS)
+void server::use_tls(const tls_options& tls_opts) {
+    namespace ssl = asio::ssl;
+
+    ssl::context ctx{ssl::context::tls_server};
+    ctx.set_options(ssl::context::default_workarounds | ssl::context::no_sslv2 |
+                    ssl::context::no_sslv3 | ssl::context::no_tlsv1 | ssl::context::no_tlsv1_1 |
+                    ssl::context::single_dh_use);
+    ctx.use_certificate_chain_file(tls_opts.certificate_chain_file);
+    ctx.use_private_key_file(tls_opts.private_key_file, ssl::context::pem);
+
+    // Resumption: the server-side session cache plus the session tickets OpenSSL issues
+    // by default let returning clients skip the expensive key exchange.
+    SSL_CTX_set_session_cache_mode(ctx.native_handle(), SSL_SESS_CACHE_SERVER);
+    SSL_CTX_set_session_id_context(
+        ctx.native_handle(),
+        reinterpret_cast<const unsigned char*>(server_token.data()), // NOLINT(*-reinterpret-cast)
+        static_cast<unsigned int>(server_token.size()));
+
+    // Hand the per-connection read/write buffers back to OpenSSL whenever they sit
+    // empty: idle keep-alive connections don't pin them, and steady-state requests
+    // reuse warm buffers from OpenSSL's freelist instead of allocating.
+    SSL_CTX_set_mode(ctx.native_handle(), SSL_MODE_RELEASE_BUFFERS);
+
+    SSL_CTX_set_alpn_select_cb(ctx.native_handle(), select_alpn_protocol, nullptr);
+
+    tls_ctx_.emplace(std::move(ctx));
+    tls_handshake_timeout_ = tls_opts.handshake_timeout;
+}
+#endif
+
+asio::awaitable<void> server::wait_for_session_capacity() const {
+    if (opts_.max_concurrent_sessions == 0) {
+        co_return;
+    }
+
+    using namespace std::chrono_literals;
+
+    // At the ceiling the server is already juggling a crowd of sessions; a coarse
+    // poll is plenty and avoids bookkeeping a wakeup list. The kernel listen backlog
+    // queues connections in the meantime.
+    constexpr auto poll_interval = 10ms;
+    auto executor = co_await asio::this_coro::executor;
+    asio::steady_timer backoff(executor);
+    while (live_sessions_.load(std::memory_order_relaxed) >= opts_.max_concurrent_sessions &&
+           !stop_source_.stop_requested()) {
+        backoff.expires_after(poll_interval);
+        co_await backoff.async_wait(asio::deferred);
+    }
+}
+
+bool server::sample_trace() const noexcept {
+#if defined(FAWKES_ENABLE_TRACING)
+    if (!trace_sink_) {
+        return false;
+    }
+
+    // Per-thread sequence: sessions never migrate between io threads, so plain
+    // arithmetic suffices and each thread samples at the configured rate.
+    static thread_local std::uint64_t request_seq = 0;
+    return ++request_seq % trace_sample_every_ == 0;
+#else
+    return false;
+#endif
+}
+
 asio::awaitable<void> server::do_listen() {
     auto main_executor = co_await asio::this_coro::executor;
 
     for (;;) {
-        // Pick executor.
-        auto executor = [main_executor, this] {
-            return io_pool_ ? io_pool_->get_executor() : main_executor;
-        }();
+        co_await wait_for_session_capacity();
+
+        // Hand the session to the least-loaded io thread, so long-lived heavy
+        // connections spread out instead of piling up the way round-robin lets them.
+        auto slot = io_pool_ != nullptr ? io_pool_->acquire() : io_thread_pool::session_slot{};
+        auto executor = slot ? asio::any_io_executor{slot.get_executor()} : main_executor;
 
         auto [ec, sock] = co_await acceptor_.async_accept(executor, asio::as_tuple);
         if (ec) {
@@ -126,60 +438,268 @@ asio::awaitable<void> server::do_listen() {
             continue;
         }
 
+        tune_socket(sock, opts_);
+
+        auto remote_endpoint = sock.remote_endpoint();
+
+#if defined(FAWKES_ENABLE_TLS)
+        if (tls_ctx_.has_value()) {
+            tls_stream stream(std::move(sock), *tls_ctx_);
+            asio::co_spawn(executor,
+                           serve_tls_session(std::move(stream), stop_source_.get_token()),
+                           [slot = std::move(slot), remote = std::move(remote_endpoint)](
+                               std::exception_ptr eptr) { handle_session_error(remote, eptr); });
+            continue;
+        }
+#endif
+
+        beast::tcp_stream stream(std::move(sock));
+        // The slot travels with the completion handler, so the context's live count
+        // drops exactly when the session ends.
+        asio::co_spawn(executor, serve_session(std::move(stream), stop_source_.get_token()),
+                       [slot = std::move(slot), remote = std::move(remote_endpoint)](
+                           std::exception_ptr eptr) { handle_session_error(remote, eptr); });
+    }
+}
+
+asio::awaitable<void> server::do_listen_local(asio::ip::tcp::acceptor& acceptor) {
+    auto executor = co_await asio::this_coro::executor;
+
+    for (;;) {
+        co_await wait_for_session_capacity();
+
+        auto [ec, sock] = co_await acceptor.async_accept(asio::as_tuple);
+        if (ec) {
+            if (ec == asio::error::operation_aborted || !acceptor.is_open()) {
+                SPDLOG_DEBUG("Acceptor is closed");
+                co_return;
+            }
+            SPDLOG_ERROR("Failed to accept new connection; ec={}", fmt::streamed(ec));
+            continue;
+        }
+
+        tune_socket(sock, opts_);
+
         auto remote_endpoint = sock.remote_endpoint();
+
+#if defined(FAWKES_ENABLE_TLS)
+        if (tls_ctx_.has_value()) {
+            tls_stream stream(std::move(sock), *tls_ctx_);
+            asio::co_spawn(executor, serve_tls_session(std::move(stream), stop_source_.get_token()),
+                           std::bind_front(handle_session_error, std::move(remote_endpoint)));
+            continue;
+        }
+#endif
+
         beast::tcp_stream stream(std::move(sock));
         asio::co_spawn(executor, serve_session(std::move(stream), stop_source_.get_token()),
                        std::bind_front(handle_session_error, std::move(remote_endpoint)));
     }
 }
 
-asio::awaitable<void> server::serve_session(beast::tcp_stream stream,
-                                            std::stop_token stop_token) const {
+#if defined(FAWKES_ENABLE_TLS)
+asio::awaitable<void> server::serve_tls_session(tls_stream stream,
+                                                std::stop_token stop_token) const {
     using namespace std::chrono_literals;
 
     auto executor = co_await asio::this_coro::executor;
 
+    // The handshake runs under its own deadline on the per-thread timing wheel, same
+    // scheme as the read/serve deadlines; expiry aborts it by cancelling the socket.
+    auto deadline = timing_wheel::local(executor).make_timer(make_no_fail([&stream] {
+        beast::get_lowest_layer(stream).socket().cancel();
+    }));
+    if (tls_handshake_timeout_ > 0ms) {
+        deadline.expires_after(tls_handshake_timeout_);
+    }
+
+    auto [ec] = co_await stream.async_handshake(asio::ssl::stream_base::server, asio::as_tuple);
+    deadline.cancel();
+    if (ec) {
+        SPDLOG_DEBUG("TLS handshake failed; ec={}", fmt::streamed(ec));
+        co_return;
+    }
+
+    co_await serve_session(std::move(stream), std::move(stop_token));
+}
+#endif
+
+template<typename Stream>
+asio::awaitable<void> server::serve_session(Stream stream, std::stop_token stop_token) const {
+    using namespace std::chrono_literals;
+
+    live_sessions_.fetch_add(1, std::memory_order_relaxed);
+    const count_guard session_count_guard{live_sessions_};
+    if (metrics_enabled_) {
+        metrics_.record_session();
+    }
+
+    auto executor = co_await asio::this_coro::executor;
+
     asio::cancellation_signal stop_signal;
-    const std::stop_callback stop_callback(stop_token,
-                                           make_no_fail([&stop_signal, executor]() {
-                                               asio::dispatch(executor, [&stop_signal]() {
-                                                   stop_signal.emit(asio::cancellation_type::all);
-                                               });
-                                           }));
-
-    beast::flat_buffer buf;
+
+    // Drain registration: a pointer splice into this thread's session list. The old
+    // per-session `std::stop_callback` cost one registered callback per connection
+    // and fanned a cross-thread dispatch out of `request_stop()` for each of them;
+    // the registry walks each thread's list locally with one posted task per thread.
+    bool draining = false;
+    session_registry::node drain_node;
+    drain_node.stop = make_no_fail([&draining, &stop_signal] {
+        draining = true;
+        stop_signal.emit(asio::cancellation_type::all);
+    });
+    drain_node.hard_cancel = make_no_fail([&stream] {
+        beast::get_lowest_layer(stream).close();
+    });
+    sessions_.link(drain_node, executor);
+    const unlink_guard unlink_on_exit{sessions_, drain_node};
+
+    // Rented from the per-thread pool and returned on disconnect, so keep-alive traffic
+    // performs no buffer allocations in steady state.
+    auto buf_lease = buffer_pool::local().acquire();
+    auto& buf = buf_lease.get();
     const auto read_timeout = opts_.effective_read_timeout();
 
+    // Per-connection request/response state recycled across keep-alive requests; the
+    // parser cannot be reused and is re-constructed per request.
+    request fwk_req;
+    response fwk_resp;
+    {
+        boost::system::error_code remote_ec;
+        fwk_req.set_remote(beast::get_lowest_layer(stream).socket().remote_endpoint(remote_ec));
+    }
+
+    // Per-request scratch memory shared by the framework, handlers and boost.json;
+    // rewound once per request below, after the previous response has fully drained.
+    class arena session_arena;
+    fwk_req.set_arena(&session_arena);
+
+    // Coarse session deadline on the per-thread timing wheel; re-arming is an O(1)
+    // bucket move instead of an asio timer operation. Expiry aborts whatever socket
+    // operation the session is awaiting.
+    auto deadline = timing_wheel::local(executor).make_timer(make_no_fail([&stream] {
+        beast::get_lowest_layer(stream).socket().cancel();
+    }));
+
+    [[maybe_unused]] std::chrono::steady_clock::time_point before_read;
+
+    // Phase trace of the request currently being served; compiled out entirely unless
+    // FAWKES_ENABLE_TRACING is defined.
+    request_trace trace;
+
+    // Reads until the header of the next request completes, consuming pipelined bytes
+    // already sitting in `buf` before touching the socket.
+    const auto read_header =
+        [&](http::request_parser<http::string_body>& parser) -> asio::awaitable<void> {
+        bool reading_started = false;
+        while (!parser.is_header_done()) {
+            if (buf.size() > 0) {
+                boost::system::error_code ec;
+                const auto bytes_consumed = parser.put(buf.data(), ec);
+                if (ec && ec != http::error::need_more) {
+                    throw std::system_error(ec);
+                }
+                buf.consume(bytes_consumed);
+
+                // The idle timer runs until the first octets of the request show up.
+                if (!reading_started && bytes_consumed > 0) {
+                    reading_started = true;
+                    before_read = std::chrono::steady_clock::now();
+                    trace.begin(before_read);
+                    if (read_timeout > 0ms) {
+                        deadline.expires_after(read_timeout);
+                    }
+                }
+
+                if (parser.is_header_done()) {
+                    break;
+                }
+            }
+
+            constexpr std::size_t read_chunk_size = 512U;
+            const auto bytes_read = co_await stream.async_read_some(
+                buf.prepare(read_chunk_size),
+                asio::bind_cancellation_slot(stop_signal.slot(), asio::deferred));
+            buf.commit(bytes_read);
+            if (metrics_enabled_) {
+                metrics_.record_bytes_in(bytes_read);
+            }
+        }
+
+        trace.mark(request_trace::point::header_done);
+    };
+
+    // The response of the previous request, written while the next request is being read.
+    // Its trace travels alongside: the write-done point lands only once the bytes have
+    // actually drained, which overlaps reading (and tracing) the next request.
+    std::optional<http::message_generator> pending_resp;
+    std::optional<request_trace> pending_trace;
+    const auto write_pending = [&]() -> asio::awaitable<void> {
+        if (pending_resp.has_value()) {
+            auto resp = std::move(*pending_resp);
+            pending_resp.reset();
+            const auto write_started = std::chrono::steady_clock::now();
+            const auto bytes_written = co_await beast::async_write(stream, std::move(resp));
+            if (metrics_enabled_) {
+                metrics_.record_bytes_out(bytes_written);
+                metrics_.record_latency(metrics_registry::phase::write,
+                                        std::chrono::steady_clock::now() - write_started);
+            }
+            if (pending_trace.has_value()) {
+                pending_trace->mark(request_trace::point::write_done);
+                trace_sink_(*pending_trace);
+                pending_trace.reset();
+            }
+        }
+    };
+
+    using namespace asio::experimental::awaitable_operators;
+
     // TODO(KC): handle http async_read/async_write exception ?
     // can stream still be usable in this case?
     for (;;) {
         http::request_parser<http::string_body> parser;
 
+        // Sampling decision for the request about to arrive.
+        if (sample_trace()) {
+            trace.arm();
+        } else {
+            trace.disarm();
+        }
+
         if (opts_.idle_timeout > 0ms) {
-            stream.expires_after(opts_.idle_timeout);
+            deadline.expires_after(opts_.idle_timeout);
         }
 
-        constexpr std::size_t initial_buf_size = 512U;
-        const auto bytes_read = co_await stream.async_read_some(
-            buf.prepare(initial_buf_size),
-            asio::bind_cancellation_slot(stop_signal.slot(), asio::deferred));
-        buf.commit(bytes_read);
+        // Pipelining: the previous response drains while the header of the next request
+        // is read and parsed. Handlers never run concurrently with an in-flight write,
+        // so direct streaming through `response_stream` stays safe.
+        co_await (read_header(parser) && write_pending());
 
-        if (read_timeout > 0ms) {
-            stream.expires_after(read_timeout);
-        }
+        fwk_req.set_received_at(before_read);
 
-        [[maybe_unused]] const auto before_read = std::chrono::steady_clock::now();
+        // The previous response is on the wire; nothing can still reference the arena.
+        session_arena.reset();
 
-        boost::system::error_code ec;
-        const auto bytes_consumed = parser.put(buf.data(), ec);
-        if (ec && ec != http::error::need_more) {
-            throw std::system_error(ec);
-        }
-        buf.consume(bytes_consumed);
+        // WebSocket upgrades fork off before any body handling; once matched, the
+        // connection is dedicated to the websocket session and never returns here.
+        if (router_.has_ws_routes() && websocket::is_upgrade(parser.get())) {
+            const auto* entry = locate_ws_route(parser.get(), fwk_req);
+            if (entry != nullptr) {
+                co_await write_pending();
+                // The websocket layer brings its own timeout machinery.
+                deadline.cancel();
+                trace.disarm();
 
-        if (!parser.is_header_done()) {
-            co_await http::async_read_header(stream, buf, parser);
+                websocket::stream<Stream> ws{std::move(stream)};
+                // The graceful drain pass leaves an established push channel alone;
+                // the hard-cancel backstop now tears down the websocket's transport.
+                drain_node.hard_cancel = make_no_fail([&ws] {
+                    beast::get_lowest_layer(ws).close();
+                });
+                co_await run_ws_session(ws, buf, parser.release(), fwk_req, *entry);
+                co_return;
+            }
         }
 
         if (beast::iequals(parser.get()[http::field::expect], expect_value)) {
@@ -188,70 +708,367 @@ asio::awaitable<void> server::serve_session(beast::tcp_stream stream,
             co_await http::async_write(stream, continue_resp);
         }
 
+        // Streaming routes are dispatched right after the header completes: the handler
+        // consumes the body incrementally by itself.
+        if (router_.has_stream_routes()) {
+            const auto* entry = locate_stream_route(parser.get(), fwk_req);
+            if (entry != nullptr) {
+                if (opts_.serve_timeout > 0ms) {
+                    deadline.expires_after(opts_.serve_timeout);
+                }
+
+                set_body_limit(parser, opts_);
+                body_stream reader(stream, buf, std::move(parser));
+                fwk_req.set_body_reader(&reader);
+                response_stream resp_stream(stream);
+
+                // The body is handed to the handler as-is; both points collapse here.
+                trace.mark(request_trace::point::read_done);
+                trace.mark(request_trace::point::routed);
+
+                auto or_resp = co_await handle_located_request(fwk_req, fwk_resp, entry,
+                                                               &resp_stream, trace);
+
+                // Discard whatever the handler left unread so the connection stays usable.
+                if (!reader.done()) {
+                    co_await reader.drain();
+                }
+
+                bool keep_alive = resp_stream.keep_alive();
+                std::uint64_t bytes_out = resp_stream.wire_bytes();
+                if (or_resp.has_value()) {
+                    keep_alive = or_resp->keep_alive();
+                    bytes_out += co_await beast::async_write(stream, std::move(*or_resp));
+                }
+                if (metrics_enabled_) {
+                    metrics_.record_bytes_in(reader.wire_bytes());
+                    metrics_.record_bytes_out(bytes_out);
+                }
+
+                if (trace.armed()) {
+                    trace.mark(request_trace::point::write_done);
+                    trace_sink_(trace);
+                    trace.disarm();
+                }
+
+                if (!keep_alive || stop_token.stop_requested() || draining) {
+                    break;
+                }
+                continue;
+            }
+        }
+
         // Read the body.
         if (!parser.is_done()) {
             set_body_limit(parser, opts_);
-            co_await http::async_read(stream, buf, parser);
+            const auto body_bytes = co_await http::async_read(stream, buf, parser);
+            if (metrics_enabled_) {
+                metrics_.record_bytes_in(body_bytes);
+            }
         }
 
+        trace.mark(request_trace::point::read_done);
+
         if (opts_.serve_timeout > 0ms) {
             const auto read_elapsed = std::chrono::steady_clock::now() - before_read;
-            stream.expires_after(opts_.serve_timeout - read_elapsed);
+            deadline.expires_after(opts_.serve_timeout - read_elapsed);
         }
 
-        auto resp = co_await handle_request(parser.release());
-        const bool keep_alive = resp.keep_alive();
+        response_stream resp_stream(stream);
+        auto or_resp =
+            co_await handle_request(parser.release(), fwk_req, fwk_resp, &resp_stream, trace);
+
+        bool keep_alive = resp_stream.keep_alive();
+        if (or_resp.has_value()) {
+            keep_alive = or_resp->keep_alive();
+            pending_resp = std::move(or_resp);
+        }
 
-        co_await beast::async_write(stream, std::move(resp));
+        // A handler that streamed its response wrote to the socket directly; those
+        // bytes never pass through the pipelined write above.
+        if (metrics_enabled_ && resp_stream.started()) {
+            metrics_.record_bytes_out(resp_stream.wire_bytes());
+        }
 
-        if (!keep_alive || stop_token.stop_requested()) {
+        if (trace.armed()) {
+            if (pending_resp.has_value()) {
+                pending_trace = trace;
+            } else {
+                // Streamed by the handler; the response is already on the wire.
+                trace.mark(request_trace::point::write_done);
+                trace_sink_(trace);
+            }
+            trace.disarm();
+        }
+
+        if (!keep_alive || stop_token.stop_requested() || draining) {
+            co_await write_pending();
             break;
         }
     }
 
-    stream.socket().shutdown(asio::ip::tcp::socket::shutdown_both);
+    co_await shutdown_stream(stream);
 }
 
-asio::awaitable<http::message_generator> server::handle_request(
-    http::request<http::string_body> req) const {
+template<typename Stream>
+asio::awaitable<void> server::run_ws_session(beast::websocket::stream<Stream>& ws,
+                                             beast::flat_buffer& buf,
+                                             http::request<http::string_body> req,
+                                             request& fwk_req,
+                                             const route_entry& entry) const {
+    // Timeouts move to the websocket's own idle/handshake machinery; the tcp layer
+    // must not also time the stream out underneath it.
+    beast::get_lowest_layer(ws).expires_never();
+    ws.set_option(websocket::stream_base::timeout::suggested(beast::role_type::server));
+
+    // Deflate contexts live inside the stream for the connection's lifetime, amortized
+    // across all of its messages; beast offers no hook to pool them across connections.
+    websocket::permessage_deflate deflate;
+    deflate.server_enable = true;
+    ws.set_option(deflate);
+
+    ws.set_option(websocket::stream_base::decorator([](websocket::response_type& resp) {
+        resp.set(http::field::server, server_token);
+    }));
+
+    co_await ws.async_accept(req);
+
+    if (metrics_enabled_) {
+        metrics_.record_request(static_cast<std::uint32_t>(http::status::switching_protocols));
+    }
+
+    ws_session session(ws, buf);
+    try {
+        co_await entry.ws(std::as_const(fwk_req), session);
+    } catch (const std::exception& ex) {
+        SPDLOG_WARN("WebSocket handler error; ex={}", ex.what());
+    }
+    co_await session.close();
+}
+
+asio::awaitable<std::optional<http::message_generator>> server::handle_request(
+    http::request<http::string_body> req, request& fwk_req, response& fwk_resp,
+    response_stream* resp_stream, request_trace& trace) const {
     const auto http_ver = req.version();
     const auto keep_alive = req.keep_alive();
 
+    // Read phase: from the first octets on the wire to the fully buffered request.
+    if (metrics_enabled_ &&
+        fwk_req.received_at() != std::chrono::steady_clock::time_point{}) {
+        metrics_.record_latency(metrics_registry::phase::read,
+                                std::chrono::steady_clock::now() - fwk_req.received_at());
+    }
+
+    // One plain counter per io thread: sessions never migrate between the pool's
+    // single-threaded io_contexts, so no shared state is touched on this path.
+    static thread_local std::size_t inflight_on_thread = 0;
+    if (opts_.load_shed_inflight_per_thread > 0 &&
+        inflight_on_thread >= opts_.load_shed_inflight_per_thread) {
+        // Shed before any routing work; a canned 503 is the cheapest answer the
+        // server can produce and protects the goodput of requests already in flight.
+        static const auto canned_overloaded = [] {
+            auto canned = canned_response::json(
+                http::status::service_unavailable,
+                json::serialize(json::object{
+                    {"error", json::object{{"message", "Server overloaded"}}}}));
+            canned.with_header("Retry-After", "1");
+            return canned;
+        }();
+        fwk_resp.reset(http_ver, keep_alive);
+        canned_overloaded.apply(fwk_resp);
+        if (metrics_enabled_) {
+            metrics_.record_request(fwk_resp.status_code());
+        }
+        trace.mark(request_trace::point::handled);
+        co_return prepare_response(fwk_resp);
+    }
+
+    ++inflight_on_thread;
+    const count_guard inflight_guard{inflight_on_thread};
+
     try {
-        request fwk_req(std::move(req));
-        response fwk_resp(http_ver, keep_alive);
+        fwk_req.reset(std::move(req));
 
         // Locating route completes path params for a request, and may be used in
         // a middleware.
-        const auto* handler = router_.locate_route(std::as_const(fwk_req).header().method(),
-                                                   std::as_const(fwk_req).path(),
-                                                   fwk_req.params());
+        const auto* entry = router_.locate_route(std::as_const(fwk_req).header().method(),
+                                                 std::as_const(fwk_req).path(),
+                                                 fwk_req.params());
+        trace.mark(request_trace::point::routed);
+
+        co_return co_await handle_located_request(fwk_req, fwk_resp, entry, resp_stream,
+                                                  trace);
+    } catch (const std::exception& ex) {
+        // Same policy as handle_located_request: once part of a streamed response went
+        // out, a 500 written here would land in the middle of an unterminated chunked
+        // body; propagate so the session tears down instead.
+        if (resp_stream != nullptr && resp_stream->started() && !resp_stream->finished()) {
+            throw;
+        }
 
-        if (co_await router_.run_pre_handle(fwk_req, fwk_resp) == middleware_result::abort) {
-            co_return prepare_response(fwk_resp);
+        if (metrics_enabled_) {
+            metrics_.record_request(
+                static_cast<std::uint32_t>(http::status::internal_server_error));
+        }
+        trace.mark(request_trace::point::handled);
+        const json::object body{{"error", json::object{{"message", ex.what()}}}};
+        co_return make_unexpected_error_response(http_ver,
+                                                 keep_alive,
+                                                 json::serialize(body));
+    }
+}
+
+asio::awaitable<std::optional<http::message_generator>> server::handle_located_request(
+    request& fwk_req, response& fwk_resp, const route_entry* entry,
+    response_stream* resp_stream, request_trace& trace) const {
+    const auto http_ver = fwk_req.as_impl().version();
+    const auto keep_alive = fwk_req.as_impl().keep_alive();
+
+    // Every completed response funnels through here so the handle phase is timed and
+    // counted exactly once per request.
+    const auto handle_started = std::chrono::steady_clock::now();
+    const auto finalize = [&, handle_started](response& resp) {
+        if (metrics_enabled_) {
+            metrics_.record_request(resp.status_code());
+            metrics_.record_latency(metrics_registry::phase::handle,
+                                    std::chrono::steady_clock::now() - handle_started);
+        }
+        trace.mark(request_trace::point::handled);
+        return prepare_response(resp);
+    };
+
+    try {
+        fwk_resp.reset(http_ver, keep_alive);
+        if (resp_stream != nullptr) {
+            resp_stream->attach(fwk_resp);
+            fwk_resp.set_stream_writer(resp_stream);
+        }
+
+        // Router-level middlewares run on every request; an all-synchronous chain is
+        // folded into plain calls without spawning the chain coroutine.
+        const bool sync_mws = router_.middlewares_synchronous();
+        auto pre_result = middleware_result::proceed;
+        if (sync_mws) {
+            pre_result = router_.run_pre_handle_sync(fwk_req, fwk_resp);
+        } else {
+            pre_result = co_await router_.run_pre_handle(fwk_req, fwk_resp);
+        }
+        if (pre_result == middleware_result::abort) {
+            co_return finalize(fwk_resp);
         }
 
         // User handler not found is not an unexpected error and thus should not abort
         // router-level middlewares.
-        if (!handler) {
-            const json::object body{
-                {"error", json::object{{"message", "Unknown resource"}}}};
-            fwk_resp.json(http::status::not_found, json::serialize(body));
-            esl::ignore_unused(co_await router_.run_post_handle(fwk_req, fwk_resp));
-            co_return prepare_response(fwk_resp);
+        if (!entry) {
+            static const auto canned_not_found = canned_response::json(
+                http::status::not_found,
+                json::serialize(json::object{
+                    {"error", json::object{{"message", "Unknown resource"}}}}));
+            canned_not_found.apply(fwk_resp);
+            if (sync_mws) {
+                esl::ignore_unused(router_.run_post_handle_sync(fwk_req, fwk_resp));
+            } else {
+                esl::ignore_unused(co_await router_.run_post_handle(fwk_req, fwk_resp));
+            }
+            co_return finalize(fwk_resp);
+        }
+
+        // A WebSocket route reached without an Upgrade; the session loop dispatches
+        // actual upgrades before ever getting here.
+        if (entry->ws) {
+            static const auto canned_upgrade_required = [] {
+                auto canned = canned_response::json(
+                    http::status::upgrade_required,
+                    json::serialize(json::object{
+                        {"error",
+                         json::object{{"message", "WebSocket upgrade required"}}}}));
+                canned.with_header("Upgrade", "websocket");
+                return canned;
+            }();
+            canned_upgrade_required.apply(fwk_resp);
+            if (sync_mws) {
+                esl::ignore_unused(router_.run_post_handle_sync(fwk_req, fwk_resp));
+            } else {
+                esl::ignore_unused(co_await router_.run_post_handle(fwk_req, fwk_resp));
+            }
+            co_return finalize(fwk_resp);
+        }
+
+        // Conditional routes revalidate before dispatch: a matching If-None-Match is
+        // answered header-only -- no handler invocation, no body allocation.
+        if (entry->etag) {
+            const auto tag = entry->etag(fwk_req);
+            if (etag_matches(fwk_req.header()[http::field::if_none_match], tag)) {
+                fwk_resp.set_status(http::status::not_modified);
+                fwk_resp.set_etag(tag);
+                if (sync_mws) {
+                    esl::ignore_unused(router_.run_post_handle_sync(fwk_req, fwk_resp));
+                } else {
+                    esl::ignore_unused(co_await router_.run_post_handle(fwk_req, fwk_resp));
+                }
+                co_return finalize(fwk_resp);
+            }
+            // The full response advertises the tag too; the handler may override it.
+            fwk_resp.set_etag(tag);
+        }
+
+        auto result = middleware_result::proceed;
+        if (entry->direct) {
+            // Middleware-free route: await the user handler's awaitable directly, no
+            // wrapper coroutine frame.
+            try {
+                co_await entry->direct(std::as_const(fwk_req), fwk_resp);
+            } catch (...) {
+                detail::render_handler_error(fwk_resp);
+            }
+        } else {
+            result = co_await (*entry)(fwk_req, fwk_resp);
         }
 
-        const auto result = co_await (*handler)(fwk_req, fwk_resp);
+        // The handler streamed the response by itself; only the final chunk may remain.
+        if (resp_stream != nullptr && resp_stream->started()) {
+            if (sync_mws) {
+                esl::ignore_unused(router_.run_post_handle_sync(fwk_req, fwk_resp));
+            } else {
+                esl::ignore_unused(co_await router_.run_post_handle(fwk_req, fwk_resp));
+            }
+            if (!resp_stream->finished()) {
+                co_await resp_stream->finish();
+            }
+            if (metrics_enabled_) {
+                metrics_.record_request(fwk_resp.status_code());
+                metrics_.record_latency(metrics_registry::phase::handle,
+                                        std::chrono::steady_clock::now() - handle_started);
+            }
+            trace.mark(request_trace::point::handled);
+            co_return std::nullopt;
+        }
 
         // Aborted by a per-route middleware.
         if (result == middleware_result::abort) {
-            co_return prepare_response(fwk_resp);
+            co_return finalize(fwk_resp);
         }
 
-        esl::ignore_unused(co_await router_.run_post_handle(fwk_req, fwk_resp));
+        if (sync_mws) {
+            esl::ignore_unused(router_.run_post_handle_sync(fwk_req, fwk_resp));
+        } else {
+            esl::ignore_unused(co_await router_.run_post_handle(fwk_req, fwk_resp));
+        }
 
-        co_return prepare_response(fwk_resp);
+        co_return finalize(fwk_resp);
     } catch (const std::exception& ex) {
+        // Cannot salvage the response once part of it went out; terminate the session.
+        if (resp_stream != nullptr && resp_stream->started() && !resp_stream->finished()) {
+            throw;
+        }
+
+        if (metrics_enabled_) {
+            metrics_.record_request(
+                static_cast<std::uint32_t>(http::status::internal_server_error));
+            metrics_.record_latency(metrics_registry::phase::handle,
+                                    std::chrono::steady_clock::now() - handle_started);
+        }
+        trace.mark(request_trace::point::handled);
         const json::object body{{"error", json::object{{"message", ex.what()}}}};
         co_return make_unexpected_error_response(http_ver,
                                                  keep_alive,
@@ -259,6 +1076,40 @@ asio::awaitable<http::message_generator> server::handle_request(
     }
 }
 
+const route_entry* server::locate_stream_route(
+    const http::request<http::string_body>& header_req, request& fwk_req) const {
+    try {
+        fwk_req.reset(http::request<http::string_body>{header_req});
+        const auto* entry = router_.locate_route(std::as_const(fwk_req).header().method(),
+                                                 std::as_const(fwk_req).path(),
+                                                 fwk_req.params());
+        if (entry && entry->streams_body) {
+            return entry;
+        }
+    } catch (const std::exception&) { // NOLINT(bugprone-empty-catch)
+        // Fall through to the buffered path, which reports the error after the read.
+    }
+
+    return nullptr;
+}
+
+const route_entry* server::locate_ws_route(
+    const http::request<http::string_body>& header_req, request& fwk_req) const {
+    try {
+        fwk_req.reset(http::request<http::string_body>{header_req});
+        const auto* entry = router_.locate_route(std::as_const(fwk_req).header().method(),
+                                                 std::as_const(fwk_req).path(),
+                                                 fwk_req.params());
+        if (entry && entry->ws) {
+            return entry;
+        }
+    } catch (const std::exception&) { // NOLINT(bugprone-empty-catch)
+        // Fall through to the buffered path, which reports the error after the read.
+    }
+
+    return nullptr;
+}
+
 // static
 void server::handle_session_error(const asio::ip::tcp::endpoint& remote, std::exception_ptr eptr) {
     if (eptr) {
@@ -5,27 +5,43 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <limits>
+#include <optional>
 #include <stop_token>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <boost/asio/awaitable.hpp>
 #include <boost/asio/cancellation_signal.hpp>
 #include <boost/asio/cancellation_state.hpp>
+#include <boost/asio/dispatch.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
 #include <boost/beast/core/tcp_stream.hpp>
 #include <boost/beast/http/message.hpp>
 #include <boost/beast/http/message_generator.hpp>
 #include <boost/beast/http/string_body.hpp>
+#include <boost/beast/websocket/stream.hpp>
+
+#if defined(FAWKES_ENABLE_TLS)
+#include <boost/asio/ssl/context.hpp>
+#endif
 
 #include "fawkes/io_thread_pool.hpp"
+#include "fawkes/metrics.hpp"
+#include "fawkes/route_group.hpp"
 #include "fawkes/router.hpp"
+#include "fawkes/session_registry.hpp"
+#include "fawkes/tls_stream.hpp"
+#include "fawkes/trace.hpp"
 
 namespace fawkes {
 
@@ -68,8 +84,64 @@ public:
 
         // Size in bytes.
         std::size_t request_body_limit{options::default_body_limit};
+
+        // Disables Nagle's algorithm on accepted sockets.
+        bool tcp_no_delay{false};
+
+        // `TCP_DEFER_ACCEPT` timeout on the listener; the kernel won't wake the acceptor
+        // until data arrives. If zero, the option is not set.
+        // Ignored on platforms without the option.
+        std::chrono::seconds tcp_defer_accept{0};
+
+        // `TCP_FASTOPEN` queue length on the listener. If zero, the option is not set.
+        // Ignored on platforms without the option.
+        int tcp_fastopen_queue{0};
+
+        // `SO_SNDBUF` / `SO_RCVBUF` in bytes on accepted sockets.
+        // If zero, kernel defaults are kept.
+        int send_buffer_size{0};
+        int receive_buffer_size{0};
+
+        // Listen backlog of the listener.
+        // If zero, `max_listen_connections` is used.
+        int listen_backlog{0};
+
+        // Ceiling on concurrently served connections across all acceptors.
+        // At capacity the server pauses `async_accept`, letting the kernel listen
+        // backlog absorb bursts instead of degrading every in-flight session.
+        // If zero, there is no ceiling.
+        std::size_t max_concurrent_sessions{0};
+
+        // Sheds load with a canned 503 before any routing work once the number of
+        // in-flight requests on an io thread reaches this threshold.
+        // If zero, shedding is disabled.
+        std::size_t load_shed_inflight_per_thread{0};
+
+        // How long `stop()` waits for in-flight sessions to finish before their
+        // connections are torn down. If zero, lingering sessions are hard-cancelled
+        // right after the graceful pass.
+        std::chrono::milliseconds drain_grace_period{5000};
+
+        // If enabled and an `io_thread_pool` is attached, `listen_and_serve()` opens one
+        // `SO_REUSEPORT` listener per pool thread, and each io thread accepts and serves
+        // its own connections without cross-thread handoff.
+        // Falls back to the single-acceptor mode if the platform doesn't support
+        // `SO_REUSEPORT`.
+        bool reuse_port{false};
     };
 
+#if defined(FAWKES_ENABLE_TLS)
+    struct tls_options {
+        // Certificate chain and private key, both in PEM format.
+        std::string certificate_chain_file;
+        std::string private_key_file;
+
+        // The maximum duration allowed to complete the TLS handshake.
+        // If zero or negative, there is no timeout.
+        std::chrono::milliseconds handshake_timeout{10'000};
+    };
+#endif
+
     explicit server(asio::io_context& io_ctx)
         : io_ctx_(io_ctx),
           acceptor_(io_ctx_) {}
@@ -92,6 +164,15 @@ public:
 
     void listen_and_serve(const std::string& addr, std::uint16_t port);
 
+#if defined(FAWKES_ENABLE_TLS)
+    // Turns the server into a TLS terminator: every accepted connection must complete
+    // a handshake against one shared `ssl::context` before being served. Session
+    // resumption is enabled on the context, so returning clients skip the full
+    // handshake. Must be called before `listen_and_serve()`.
+    // Throws `boost::system::system_error` if the certificate or key cannot be loaded.
+    void use_tls(const tls_options& tls_opts);
+#endif
+
     // Not thread-safe, must be called on the thread running the acceptor's executor.
     // This function initiates the shutdown of the server, and returns immediately.
     void stop() {
@@ -106,7 +187,20 @@ public:
 #endif
         [[maybe_unused]] boost::system::error_code ec;
         acceptor_.close(ec);
+
+        // Per-thread acceptors in reuse-port mode live on their own executors.
+        for (auto& acceptor : pool_acceptors_) {
+            asio::dispatch(acceptor.get_executor(), [&acceptor] {
+                [[maybe_unused]] boost::system::error_code close_ec;
+                acceptor.close(close_ec);
+            });
+        }
+
         stop_source_.request_stop();
+
+        // One posted task per io thread walks that thread's session list locally;
+        // stragglers are hard-cancelled once the grace period elapses.
+        sessions_.drain(opts_.drain_grace_period);
     }
 
     // Throws `std::invalid_argument` if there is path conflict.
@@ -183,18 +277,158 @@ public:
         router_.add_route(http::verb::head, path, std::move(middlewares), std::forward<H>(handler));
     }
 
+    // Like `do_post()`, but the request body is not buffered before the handler runs:
+    // the handler consumes it incrementally through `request::body_reader()`.
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_user_handler H>
+    void do_post_stream(std::string_view path, H&& handler) {
+        router_.add_stream_route(http::verb::post, path, std::forward<H>(handler));
+    }
+
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_user_handler H, is_middleware... Mws>
+    void do_post_stream(std::string_view path, std::tuple<Mws...>&& middlewares, H&& handler) {
+        router_.add_stream_route(http::verb::post, path, std::move(middlewares),
+                                 std::forward<H>(handler));
+    }
+
+    // Registers a WebSocket endpoint at GET `path`. On a matching Upgrade request the
+    // server completes the handshake -- permessage-deflate negotiated -- and invokes
+    // `handler` with the established session; the connection belongs to the handler
+    // until it returns or the peer closes. Non-upgrade requests to the path answer 426.
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_ws_handler H>
+    void do_ws(std::string_view path, H&& handler) {
+        router_.add_ws_route(path, std::forward<H>(handler));
+    }
+
+    // Like `do_put()`, but the request body is not buffered before the handler runs.
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_user_handler H>
+    void do_put_stream(std::string_view path, H&& handler) {
+        router_.add_stream_route(http::verb::put, path, std::forward<H>(handler));
+    }
+
+    // Throws `std::invalid_argument` if there is path conflict.
+    template<is_user_handler H, is_middleware... Mws>
+    void do_put_stream(std::string_view path, std::tuple<Mws...>&& middlewares, H&& handler) {
+        router_.add_stream_route(http::verb::put, path, std::move(middlewares),
+                                 std::forward<H>(handler));
+    }
+
+    // Routes registered through a group share a composed path prefix and a middleware
+    // tuple merged into each route's wrapper at registration; see `route_group`.
+    // Throws `std::invalid_argument` if `prefix` is malformed.
+    [[nodiscard]] route_group<> group(std::string_view prefix) {
+        return {router_, prefix, {}};
+    }
+
+    template<is_middleware... Mws>
+    [[nodiscard]] route_group<Mws...> group(std::string_view prefix,
+                                            std::tuple<Mws...>&& middlewares) {
+        return {router_, prefix, std::move(middlewares)};
+    }
+
     router& get_router() {
         return router_;
     }
 
+    // Connections currently being served, across all acceptors.
+    [[nodiscard]] std::size_t live_sessions() const noexcept {
+        return live_sessions_.load(std::memory_order_relaxed);
+    }
+
+    // Turns on metric recording at the serve-path hooks and registers a GET route at
+    // `path` serving the aggregated counters in Prometheus text exposition format.
+    // Register like any other route, i.e. before the router is compiled.
+    // Throws `std::invalid_argument` if there is path conflict.
+    void enable_metrics(std::string_view path = "/metrics") {
+        metrics_enabled_ = true;
+        router_.add_route(
+            http::verb::get, path,
+            [this](const request& /*req*/, response& resp) -> asio::awaitable<void> {
+                resp.text(http::status::ok, metrics_.render_prometheus(live_sessions()));
+                resp.header().set(http::field::content_type, "text/plain; version=0.0.4");
+                co_return;
+            });
+    }
+
+    [[nodiscard]] const metrics_registry& metrics() const noexcept {
+        return metrics_;
+    }
+
+    // Registers a per-request trace sink, invoked on the session's io thread once the
+    // traced response has drained. One request out of every `sample_every` is traced.
+    // Inert -- and completely compiled out of the serve path -- unless the library is
+    // built with FAWKES_ENABLE_TRACING.
+    void set_trace_sink(trace_sink_t sink, std::uint32_t sample_every = 1) {
+        trace_sink_ = std::move(sink);
+        trace_sample_every_ = std::max(sample_every, 1U);
+    }
+
 private:
     asio::awaitable<void> do_listen();
 
-    [[nodiscard]] asio::awaitable<void> serve_session(beast::tcp_stream stream,
+    // Returns once the session count is below the configured ceiling (or immediately
+    // when no ceiling is set); new connections queue in the kernel backlog meanwhile.
+    [[nodiscard]] asio::awaitable<void> wait_for_session_capacity() const;
+
+    // Accepts and serves connections on the executor the acceptor is bound to.
+    // Used by the reuse-port mode only.
+    asio::awaitable<void> do_listen_local(asio::ip::tcp::acceptor& acceptor);
+
+    // Serves one established -- and, for TLS, already handshaken -- connection.
+    template<typename Stream>
+    [[nodiscard]] asio::awaitable<void> serve_session(Stream stream,
                                                       std::stop_token stop_token) const;
 
-    [[nodiscard]] asio::awaitable<http::message_generator> handle_request(
-        http::request<http::string_body> req) const;
+#if defined(FAWKES_ENABLE_TLS)
+    // Runs the handshake under its own deadline, then hands off to `serve_session()`.
+    [[nodiscard]] asio::awaitable<void> serve_tls_session(tls_stream stream,
+                                                          std::stop_token stop_token) const;
+#endif
+
+    // Returns no message if the handler streamed the response by itself through
+    // `resp_stream`, in which case there is nothing left to write.
+    // `fwk_req`/`fwk_resp` are per-connection state recycled across keep-alive requests.
+    [[nodiscard]] asio::awaitable<std::optional<http::message_generator>> handle_request(
+        http::request<http::string_body> req,
+        request& fwk_req,
+        response& fwk_resp,
+        response_stream* resp_stream,
+        request_trace& trace) const;
+
+    // Runs middlewares and the handler of an already located route.
+    [[nodiscard]] asio::awaitable<std::optional<http::message_generator>>
+    handle_located_request(request& fwk_req,
+                           response& fwk_resp,
+                           const route_entry* entry,
+                           response_stream* resp_stream,
+                           request_trace& trace) const;
+
+    // True if the trace sink should see the upcoming request; constant false when
+    // tracing is compiled out.
+    [[nodiscard]] bool sample_trace() const noexcept;
+
+    // Resets `fwk_req` from the parsed header and returns its route entry if the route
+    // streams its body; returns null otherwise, including when the request target fails
+    // to parse, in which case the normal buffered path reports the error.
+    [[nodiscard]] const route_entry* locate_stream_route(
+        const http::request<http::string_body>& header_req, request& fwk_req) const;
+
+    // Same, for WebSocket routes; consulted only on Upgrade requests.
+    [[nodiscard]] const route_entry* locate_ws_route(
+        const http::request<http::string_body>& header_req, request& fwk_req) const;
+
+    // Takes over an upgraded connection: completes the WebSocket handshake, runs the
+    // route handler with the session, and closes the connection when it returns.
+    template<typename Stream>
+    [[nodiscard]] asio::awaitable<void> run_ws_session(
+        beast::websocket::stream<Stream>& ws,
+        beast::flat_buffer& buf,
+        http::request<http::string_body> req,
+        request& fwk_req,
+        const route_entry& entry) const;
 
     static void handle_session_error(const asio::ip::tcp::endpoint& remote,
                                      std::exception_ptr eptr);
@@ -204,7 +438,22 @@ private:
     options opts_;
     std::stop_source stop_source_;
     asio::ip::tcp::acceptor acceptor_;
+    std::vector<asio::ip::tcp::acceptor> pool_acceptors_;
     router router_;
+    // Mutated from the const serve path; sessions may run on multiple io threads.
+    mutable std::atomic<std::size_t> live_sessions_{0};
+    // Same: recorded into from the const serve path, per-thread shards inside.
+    mutable metrics_registry metrics_;
+    bool metrics_enabled_{false};
+    // Same: sessions on the const serve path link themselves in, per-thread lists
+    // inside.
+    mutable session_registry sessions_;
+    trace_sink_t trace_sink_;
+    std::uint32_t trace_sample_every_{1};
+#if defined(FAWKES_ENABLE_TLS)
+    std::optional<asio::ssl::context> tls_ctx_;
+    std::chrono::milliseconds tls_handshake_timeout_{0};
+#endif
 };
 
 } // namespace fawkes
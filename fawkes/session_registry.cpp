@@ -0,0 +1,110 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/session_registry.hpp"
+
+#include <cstdint>
+#include <utility>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+
+namespace fawkes {
+
+namespace asio = boost::asio;
+
+session_registry::shard& session_registry::local_shard(const asio::any_io_executor& executor) {
+    // Keyed by the registry's never-reused id so multiple servers sharing an io thread
+    // keep separate lists -- and so a registry constructed where a destroyed one lived
+    // cannot inherit its freed shards. Entries of dead registries linger until thread
+    // exit but are never looked up again.
+    static thread_local boost::unordered_flat_map<std::uint64_t, shard*> tls_shards;
+
+    const auto [it, inserted] = tls_shards.try_emplace(id_, nullptr);
+    if (inserted) {
+        auto owned = std::make_unique<shard>();
+        owned->executor = executor;
+        it->second = owned.get();
+        const std::lock_guard lock(shards_mutex_);
+        shards_.push_back(std::move(owned));
+    }
+    return *it->second;
+}
+
+void session_registry::link(node& nd, const asio::any_io_executor& executor) {
+    auto& sd = local_shard(executor);
+    nd.owner_ = &sd;
+    nd.prev_ = nullptr;
+    nd.next_ = sd.head;
+    if (sd.head != nullptr) {
+        sd.head->prev_ = &nd;
+    }
+    sd.head = &nd;
+}
+
+void session_registry::unlink(node& nd) noexcept {
+    if (nd.owner_ == nullptr) {
+        return;
+    }
+
+    if (nd.prev_ != nullptr) {
+        nd.prev_->next_ = nd.next_;
+    } else {
+        nd.owner_->head = nd.next_;
+    }
+    if (nd.next_ != nullptr) {
+        nd.next_->prev_ = nd.prev_;
+    }
+    nd.prev_ = nullptr;
+    nd.next_ = nullptr;
+    nd.owner_ = nullptr;
+}
+
+void session_registry::drain(std::chrono::milliseconds grace) {
+    std::vector<shard*> shards;
+    {
+        const std::lock_guard lock(shards_mutex_);
+        shards.reserve(shards_.size());
+        for (const auto& sd : shards_) {
+            shards.push_back(sd.get());
+        }
+    }
+
+    for (auto* sd : shards) {
+        asio::post(sd->executor, [sd, grace] {
+            // `stop` may unlink the node inline, so grab the successor first.
+            for (auto* nd = sd->head; nd != nullptr;) {
+                auto* next = nd->next_;
+                if (nd->stop) {
+                    nd->stop();
+                }
+                nd = next;
+            }
+
+            if (sd->head == nullptr) {
+                return;
+            }
+
+            // Backstop for sessions that ignore the graceful pass, e.g. stuck mid
+            // write to a slow peer. The timer lives on the shard's own thread.
+            auto deadline = std::make_shared<asio::steady_timer>(sd->executor);
+            deadline->expires_after(grace);
+            deadline->async_wait([sd, deadline](const boost::system::error_code& ec) {
+                if (ec) {
+                    return;
+                }
+                for (auto* nd = sd->head; nd != nullptr;) {
+                    auto* next = nd->next_;
+                    if (nd->hard_cancel) {
+                        nd->hard_cancel();
+                    }
+                    nd = next;
+                }
+            });
+        });
+    }
+}
+
+} // namespace fawkes
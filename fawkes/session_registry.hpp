@@ -0,0 +1,85 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/asio/any_io_executor.hpp>
+
+#include "fawkes/instance_id.hpp"
+#include "fawkes/small_function.hpp"
+
+namespace fawkes {
+
+// An intrusive per-io-thread session list for fast graceful drain. A session links
+// itself on start and unlinks on exit -- both plain pointer splices on its own thread,
+// no allocation and no registered callback -- and `drain()` posts exactly one task per
+// io thread that walks that thread's list locally. Sessions still linked once the
+// grace period elapses are hard-cancelled.
+class session_registry {
+    struct shard;
+
+public:
+    // Embedded in the session's coroutine frame; must not outlive the session.
+    class node {
+    public:
+        // Graceful: stop accepting new requests and cancel idle waits; in-flight work
+        // finishes. Invoked on the session's own io thread.
+        small_function<void()> stop;
+
+        // Forceful: tear the connection down, in-flight work included.
+        small_function<void()> hard_cancel;
+
+    private:
+        node* prev_{nullptr};
+        node* next_{nullptr};
+        shard* owner_{nullptr};
+
+        friend class session_registry;
+    };
+
+    session_registry() = default;
+
+    ~session_registry() = default;
+
+    // Sessions reach their shard through thread-local pointers keyed by a
+    // process-unique instance id; the registry is expected to live as long as the
+    // sessions linked into it.
+    session_registry(const session_registry&) = delete;
+    session_registry(session_registry&&) = delete;
+    session_registry& operator=(const session_registry&) = delete;
+    session_registry& operator=(session_registry&&) = delete;
+
+    // Links `nd` into the calling thread's list; `executor` must be the executor the
+    // session -- and every later list operation for this thread -- runs on.
+    void link(node& nd, const boost::asio::any_io_executor& executor);
+
+    // Must be called on the same thread that linked the node.
+    void unlink(node& nd) noexcept;
+
+    // Initiates the drain: one task per io thread invokes `stop` on each of its
+    // sessions, and a per-thread timer hard-cancels whatever is still linked after
+    // `grace`. Pass zero to hard-cancel right after the graceful pass.
+    // Callable from any thread; returns immediately.
+    void drain(std::chrono::milliseconds grace);
+
+private:
+    struct shard {
+        boost::asio::any_io_executor executor;
+        node* head{nullptr};
+    };
+
+    shard& local_shard(const boost::asio::any_io_executor& executor);
+
+    const std::uint64_t id_ = detail::next_instance_id();
+    mutable std::mutex shards_mutex_;
+    std::vector<std::unique_ptr<shard>> shards_;
+};
+
+} // namespace fawkes
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <chrono>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/io_context.hpp>
+
+#include "fawkes/session_registry.hpp"
+
+namespace {
+
+namespace asio = boost::asio;
+using namespace std::chrono_literals;
+
+TEST_SUITE_BEGIN("Session Registry");
+
+TEST_CASE("Drain walks linked sessions and skips unlinked ones") {
+    asio::io_context ioc;
+    fawkes::session_registry registry;
+
+    fawkes::session_registry::node first;
+    fawkes::session_registry::node second;
+    fawkes::session_registry::node third;
+
+    int stopped = 0;
+    for (auto* nd : {&first, &second, &third}) {
+        nd->stop = [&stopped] {
+            ++stopped;
+        };
+        registry.link(*nd, ioc.get_executor());
+    }
+
+    // An exited session never sees the drain.
+    registry.unlink(second);
+
+    registry.drain(0ms);
+    ioc.run();
+
+    CHECK_EQ(stopped, 2);
+
+    registry.unlink(first);
+    registry.unlink(third);
+}
+
+TEST_CASE("Lingering sessions are hard-cancelled after the grace period") {
+    asio::io_context ioc;
+    fawkes::session_registry registry;
+
+    fawkes::session_registry::node lingering;
+    bool stopped = false;
+    bool cancelled = false;
+    lingering.stop = [&stopped] {
+        stopped = true;
+    };
+    lingering.hard_cancel = [&cancelled] {
+        cancelled = true;
+    };
+    registry.link(lingering, ioc.get_executor());
+
+    fawkes::session_registry::node prompt;
+    // The prompt session unlinks itself when asked to stop, as real sessions do once
+    // their pending operations are cancelled.
+    prompt.stop = [&registry, &prompt] {
+        registry.unlink(prompt);
+    };
+    prompt.hard_cancel = [] {
+        FAIL("a session gone before the deadline must not be cancelled");
+    };
+    registry.link(prompt, ioc.get_executor());
+
+    registry.drain(1ms);
+    ioc.run();
+
+    CHECK(stopped);
+    CHECK(cancelled);
+
+    registry.unlink(lingering);
+}
+
+TEST_CASE("Unlink is idempotent") {
+    asio::io_context ioc;
+    fawkes::session_registry registry;
+
+    fawkes::session_registry::node nd;
+    registry.link(nd, ioc.get_executor());
+    registry.unlink(nd);
+    registry.unlink(nd);
+}
+
+TEST_SUITE_END(); // Session Registry
+
+} // namespace
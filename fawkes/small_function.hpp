@@ -0,0 +1,140 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fawkes {
+
+// A move-only callable with inline small-buffer storage, replacing `std::function` on
+// dispatch hot paths: targets that fit the buffer and are nothrow-movable never touch
+// the heap, and there is no copyability requirement on the target.
+// Like `std::function`, invoking through a const instance calls the target as non-const.
+template<typename Signature, std::size_t BufSize = 64U>
+class small_function;
+
+template<typename R, typename... Args, std::size_t BufSize>
+class small_function<R(Args...), BufSize> {
+public:
+    small_function() noexcept = default;
+
+    // NOLINTNEXTLINE(google-explicit-constructor): mirrors std::function.
+    small_function(std::nullptr_t) noexcept {}
+
+    template<typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, small_function> &&
+                 std::is_invocable_r_v<R, std::remove_cvref_t<F>&, Args...>)
+    // NOLINTNEXTLINE(google-explicit-constructor): mirrors std::function.
+    small_function(F&& fn) {
+        using target_type = std::remove_cvref_t<F>;
+        if constexpr (fits_inline<target_type>) {
+            target_ = new (static_cast<void*>(buf_)) target_type(std::forward<F>(fn));
+        } else {
+            target_ = new target_type(std::forward<F>(fn));
+        }
+        ops_ = &ops_for<target_type>;
+    }
+
+    ~small_function() {
+        reset();
+    }
+
+    small_function(small_function&& other) noexcept {
+        move_from(other);
+    }
+
+    small_function& operator=(small_function&& other) noexcept {
+        if (this != &other) {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    small_function(const small_function&) = delete;
+    small_function& operator=(const small_function&) = delete;
+
+    R operator()(Args... args) const {
+        return ops_->invoke(target_, std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return target_ != nullptr;
+    }
+
+private:
+    struct operations {
+        R (*invoke)(void*, Args&&...);
+        // Moves the target from `src` into the buffer at `dst_buf` and destroys the
+        // source; null for heap-allocated targets, whose pointer transfers instead.
+        void* (*relocate)(void* dst_buf, void* src) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<typename T>
+    static constexpr bool fits_inline = sizeof(T) <= BufSize &&
+                                        alignof(T) <= alignof(std::max_align_t) &&
+                                        std::is_nothrow_move_constructible_v<T>;
+
+    template<typename T>
+    static constexpr operations make_ops() noexcept {
+        operations ops{};
+        ops.invoke = [](void* target, Args&&... args) -> R {
+            return std::invoke(*static_cast<T*>(target), std::forward<Args>(args)...);
+        };
+        if constexpr (fits_inline<T>) {
+            ops.relocate = [](void* dst_buf, void* src) noexcept -> void* {
+                auto* moved = new (dst_buf) T(std::move(*static_cast<T*>(src)));
+                static_cast<T*>(src)->~T();
+                return moved;
+            };
+            ops.destroy = [](void* target) noexcept {
+                static_cast<T*>(target)->~T();
+            };
+        } else {
+            ops.relocate = nullptr;
+            ops.destroy = [](void* target) noexcept {
+                delete static_cast<T*>(target);
+            };
+        }
+        return ops;
+    }
+
+    template<typename T>
+    static constexpr operations ops_for = make_ops<T>();
+
+    void reset() noexcept {
+        if (target_ != nullptr) {
+            ops_->destroy(target_);
+            target_ = nullptr;
+            ops_ = nullptr;
+        }
+    }
+
+    void move_from(small_function& other) noexcept {
+        if (other.target_ == nullptr) {
+            return;
+        }
+
+        ops_ = other.ops_;
+        if (ops_->relocate != nullptr) {
+            target_ = ops_->relocate(static_cast<void*>(buf_), other.target_);
+        } else {
+            target_ = other.target_;
+        }
+        other.target_ = nullptr;
+        other.ops_ = nullptr;
+    }
+
+    alignas(std::max_align_t) std::byte buf_[BufSize];
+    void* target_{nullptr};
+    const operations* ops_{nullptr};
+};
+
+} // namespace fawkes
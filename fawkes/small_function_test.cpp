@@ -0,0 +1,67 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include <doctest/doctest.h>
+
+#include "fawkes/small_function.hpp"
+
+namespace {
+
+TEST_SUITE_BEGIN("Small Function");
+
+TEST_CASE("Empty by default") {
+    const fawkes::small_function<int()> fn;
+    CHECK_FALSE(static_cast<bool>(fn));
+}
+
+TEST_CASE("Invokes inline-stored target") {
+    int cnt = 0;
+    const fawkes::small_function<int(int)> fn([&cnt](int n) {
+        cnt += n;
+        return cnt;
+    });
+
+    REQUIRE(static_cast<bool>(fn));
+    CHECK_EQ(fn(2), 2);
+    CHECK_EQ(fn(3), 5);
+}
+
+TEST_CASE("Move transfers the target") {
+    fawkes::small_function<int()> fn([] {
+        return 42;
+    });
+
+    const auto moved = std::move(fn);
+    CHECK_FALSE(static_cast<bool>(fn)); // NOLINT(bugprone-use-after-move)
+    REQUIRE(static_cast<bool>(moved));
+    CHECK_EQ(moved(), 42);
+}
+
+TEST_CASE("Supports move-only targets") {
+    auto ptr = std::make_unique<int>(7);
+    const fawkes::small_function<int()> fn([p = std::move(ptr)] {
+        return *p;
+    });
+
+    CHECK_EQ(fn(), 7);
+}
+
+TEST_CASE("Falls back to the heap for oversized targets") {
+    std::array<char, 256> big_blob{};
+    big_blob.back() = 'x';
+    fawkes::small_function<char()> fn([big_blob] {
+        return big_blob.back();
+    });
+
+    const auto moved = std::move(fn);
+    CHECK_EQ(moved(), 'x');
+}
+
+TEST_SUITE_END(); // Small Function
+
+} // namespace
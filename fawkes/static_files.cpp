@@ -0,0 +1,496 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/static_files.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <esl/strings.h>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include "fawkes/canned_response.hpp"
+#include "fawkes/mime.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+#include "fawkes/router.hpp"
+#include "fawkes/server.hpp"
+
+namespace fawkes {
+
+namespace {
+
+// A read-only mapping of one whole file, unmapped on destruction. Empty files keep
+// an empty view without touching mmap, which rejects zero-length requests.
+class file_mapping {
+public:
+    file_mapping() = default;
+
+    ~file_mapping() {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+        }
+    }
+
+    file_mapping(file_mapping&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    file_mapping& operator=(file_mapping&& other) noexcept {
+        if (this != &other) {
+            if (data_ != nullptr) {
+                ::munmap(data_, size_);
+            }
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    file_mapping(const file_mapping&) = delete;
+    file_mapping& operator=(const file_mapping&) = delete;
+
+    // Maps `path` and reports its mtime; nullopt if the path cannot be opened or is
+    // not a regular file.
+    static std::optional<std::pair<file_mapping, std::time_t>> map(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT(*-vararg)
+        if (fd < 0) {
+            return std::nullopt;
+        }
+
+        struct ::stat st {};
+        if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return std::nullopt;
+        }
+
+        file_mapping fm;
+        fm.size_ = static_cast<std::size_t>(st.st_size);
+        if (fm.size_ > 0) {
+            void* addr = ::mmap(nullptr, fm.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) { // NOLINT(*-no-int-to-ptr, performance-no-int-to-ptr)
+                ::close(fd);
+                return std::nullopt;
+            }
+            fm.data_ = addr;
+        }
+        ::close(fd);
+
+        return std::pair{std::move(fm), st.st_mtime};
+    }
+
+    [[nodiscard]] std::string_view view() const noexcept {
+        return {static_cast<const char*>(data_), size_};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return size_;
+    }
+
+private:
+    void* data_{nullptr};
+    std::size_t size_{0};
+};
+
+[[nodiscard]] std::string_view content_type_of(std::string_view path) noexcept {
+    const auto dot = path.rfind('.');
+    if (dot == std::string_view::npos) {
+        return mime::octet_stream;
+    }
+    const auto ext = path.substr(dot + 1);
+
+    struct type_mapping {
+        std::string_view ext;
+        std::string_view type;
+    };
+
+    // Few enough that a scan on the (cached) load path beats a map.
+    static constexpr std::array<type_mapping, 18> known_types{{
+        {"css", "text/css"},
+        {"gif", "image/gif"},
+        {"htm", "text/html"},
+        {"html", "text/html"},
+        {"ico", "image/x-icon"},
+        {"jpeg", "image/jpeg"},
+        {"jpg", "image/jpeg"},
+        {"js", "text/javascript"},
+        {"json", mime::json},
+        {"map", mime::json},
+        {"pdf", "application/pdf"},
+        {"png", "image/png"},
+        {"svg", "image/svg+xml"},
+        {"txt", mime::text},
+        {"wasm", "application/wasm"},
+        {"webp", "image/webp"},
+        {"woff", "font/woff"},
+        {"woff2", "font/woff2"},
+    }};
+
+    for (const auto& [known_ext, type] : known_types) {
+        if (known_ext == ext) {
+            return type;
+        }
+    }
+    return mime::octet_stream;
+}
+
+// The tree hands over the raw catch-all capture, leading slash included. Reject
+// anything that could climb out of the root; exotic-but-harmless inputs are not
+// normalized, they simply miss and answer 404.
+[[nodiscard]] bool path_is_safe(std::string_view rel) noexcept {
+    if (rel.empty() || rel.front() != '/') {
+        return false;
+    }
+    if (rel.find('\0') != std::string_view::npos) {
+        return false;
+    }
+    return rel.find("..") == std::string_view::npos;
+}
+
+// The cache hands out exactly one strong quoted tag per entry, so revalidation is a
+// scan of the If-None-Match list for that tag -- tolerating a `W/` marker an
+// intermediary may have added -- plus the `*` wildcard.
+[[nodiscard]] bool revalidates(std::string_view if_none_match,
+                               std::string_view quoted_tag) noexcept {
+    for (std::size_t pos = 0; pos < if_none_match.size();) {
+        auto sep = if_none_match.find(',', pos);
+        if (sep == std::string_view::npos) {
+            sep = if_none_match.size();
+        }
+
+        auto candidate = esl::strings::trim(if_none_match.substr(pos, sep - pos), " \t");
+        if (candidate.starts_with("W/")) {
+            candidate.remove_prefix(2);
+        }
+        if (candidate == "*" || candidate == quoted_tag) {
+            return true;
+        }
+
+        pos = sep + 1;
+    }
+    return false;
+}
+
+// Mirrors the compression middleware's Accept-Encoding handling: the coding must be
+// listed and not disabled by a `q=0` parameter.
+[[nodiscard]] bool accepts_coding(std::string_view accept_encoding,
+                                  std::string_view name) noexcept {
+    while (!accept_encoding.empty()) {
+        const auto comma = accept_encoding.find(',');
+        auto token = accept_encoding.substr(0, comma);
+        accept_encoding = comma == std::string_view::npos
+                              ? std::string_view{}
+                              : accept_encoding.substr(comma + 1);
+
+        auto params = std::string_view{};
+        if (const auto semi = token.find(';'); semi != std::string_view::npos) {
+            params = token.substr(semi + 1);
+            token = token.substr(0, semi);
+        }
+
+        if (esl::strings::trim(token, " ") != name) {
+            continue;
+        }
+
+        if (const auto q = params.find("q=0"); q != std::string_view::npos) {
+            // "q=0" or "q=0.000" disables, "q=0.5" does not.
+            const auto rest = params.substr(q + 3);
+            return rest.find_first_of("123456789") < rest.find_first_of(",; ");
+        }
+        return true;
+    }
+    return false;
+}
+
+struct byte_range {
+    enum class outcome : std::uint8_t {
+        // Absent, malformed, or multi-part: the full body is served as 200.
+        ignored,
+        partial,
+        unsatisfiable,
+    };
+
+    outcome kind{outcome::ignored};
+    std::size_t first{0};
+    std::size_t last{0};
+};
+
+// Single-part `bytes` ranges only. RFC 9110 lets a server ignore Range headers it
+// does not support, so multi-part and malformed specs fall back to the full body.
+[[nodiscard]] byte_range parse_range(std::string_view value, std::size_t size) noexcept {
+    constexpr std::string_view unit = "bytes=";
+    if (!value.starts_with(unit)) {
+        return {};
+    }
+
+    const auto spec = value.substr(unit.size());
+    if (spec.find(',') != std::string_view::npos) {
+        return {};
+    }
+
+    const auto dash = spec.find('-');
+    if (dash == std::string_view::npos) {
+        return {};
+    }
+
+    constexpr auto parse = [](std::string_view text, std::size_t& out) noexcept {
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+        return ec == std::errc{} && ptr == text.data() + text.size();
+    };
+
+    const auto first_part = spec.substr(0, dash);
+    const auto last_part = spec.substr(dash + 1);
+
+    // Suffix form `-n`: the final n bytes.
+    if (first_part.empty()) {
+        std::size_t suffix = 0;
+        if (!parse(last_part, suffix)) {
+            return {};
+        }
+        if (suffix == 0 || size == 0) {
+            return {.kind = byte_range::outcome::unsatisfiable};
+        }
+        const auto len = std::min(suffix, size);
+        return {.kind = byte_range::outcome::partial, .first = size - len, .last = size - 1};
+    }
+
+    std::size_t first = 0;
+    if (!parse(first_part, first)) {
+        return {};
+    }
+    if (first >= size) {
+        return {.kind = byte_range::outcome::unsatisfiable};
+    }
+
+    auto last = size - 1;
+    if (!last_part.empty()) {
+        if (!parse(last_part, last)) {
+            return {};
+        }
+        if (last < first) {
+            return {};
+        }
+        last = std::min(last, size - 1);
+    }
+    return {.kind = byte_range::outcome::partial, .first = first, .last = last};
+}
+
+void render_not_found(response& resp) {
+    static const auto canned_not_found = canned_response::json(
+        http::status::not_found,
+        json::serialize(json::object{{"error", json::object{{"message", "Unknown resource"}}}}));
+    canned_not_found.apply(resp);
+}
+
+} // namespace
+
+// One cached file: the identity mapping plus any precompressed siblings, with
+// validators and content type rendered once at load. A `missing` entry caches a 404.
+struct static_files::entry {
+    file_mapping body;
+    std::optional<file_mapping> gzip;
+    std::optional<file_mapping> brotli;
+    std::string etag;
+    std::string last_modified;
+    std::string_view content_type;
+    std::chrono::steady_clock::time_point expires_at;
+    // Mapped bytes counted against the shard budget, variants included.
+    std::size_t charge{0};
+    bool missing{false};
+};
+
+struct static_files::shard {
+    boost::unordered_flat_map<std::string, std::shared_ptr<const entry>,
+                              detail::route_path_hash, std::equal_to<>>
+        files;
+    std::size_t total_bytes{0};
+};
+
+static_files::static_files(options opts)
+    : opts_(std::move(opts)) {
+    while (opts_.root.ends_with('/')) {
+        opts_.root.pop_back();
+    }
+}
+
+static_files::~static_files() = default;
+
+void static_files::register_at(server& svr, std::string_view prefix) {
+    svr.do_get(fmt::format("{}/*filepath", prefix),
+               [this](const request& req, response& resp) { return serve(req, resp); });
+}
+
+asio::awaitable<void> static_files::serve(const request& req, response& resp) {
+    const auto rel = req.params().get("filepath");
+    if (!path_is_safe(rel)) {
+        render_not_found(resp);
+        co_return;
+    }
+
+    auto ent = lookup(rel);
+    if (ent->missing) {
+        render_not_found(resp);
+        co_return;
+    }
+
+    auto& hdr = resp.header();
+    resp.set_etag(ent->etag);
+    hdr.set(http::field::last_modified, ent->last_modified);
+    if (ent->gzip.has_value() || ent->brotli.has_value()) {
+        hdr.set(http::field::vary, "Accept-Encoding");
+    }
+
+    if (revalidates(req.header()[http::field::if_none_match], ent->etag)) {
+        resp.set_status(http::status::not_modified);
+        co_return;
+    }
+
+    hdr.set(http::field::content_type, ent->content_type);
+    hdr.set(http::field::accept_ranges, "bytes");
+
+    auto payload = ent->body.view();
+    if (const auto range_spec = req.header()[http::field::range]; !range_spec.empty()) {
+        // Range applies to the identity representation; precompressed siblings are
+        // never sliced.
+        const auto range = parse_range(range_spec, payload.size());
+        if (range.kind == byte_range::outcome::unsatisfiable) {
+            resp.set_status(http::status::range_not_satisfiable);
+            hdr.set(http::field::content_range, fmt::format("bytes */{}", payload.size()));
+            co_return;
+        }
+        if (range.kind == byte_range::outcome::partial) {
+            resp.set_status(http::status::partial_content);
+            hdr.set(http::field::content_range,
+                    fmt::format("bytes {}-{}/{}", range.first, range.last, payload.size()));
+            payload = payload.substr(range.first, range.last - range.first + 1);
+        }
+    } else if (opts_.serve_precompressed) {
+        const auto accept = req.header()[http::field::accept_encoding];
+        if (ent->brotli.has_value() && accepts_coding(accept, "br")) {
+            payload = ent->brotli->view();
+            hdr.set(http::field::content_encoding, "br");
+        } else if (ent->gzip.has_value() && accepts_coding(accept, "gzip")) {
+            payload = ent->gzip->view();
+            hdr.set(http::field::content_encoding, "gzip");
+        }
+    }
+
+    auto& segments = resp.segments();
+    segments.borrow(payload);
+    // The mapping must stay resident until the write completes, even if the cache
+    // evicts the entry while a pipelined response is still draining.
+    segments.retain(std::move(ent));
+}
+
+static_files::shard& static_files::local_shard() {
+    // Keyed by the never-reused instance id so two subsystems sharing an io thread
+    // keep separate caches and budgets, and so an instance constructed where a
+    // destroyed one lived cannot inherit its freed shard.
+    static thread_local boost::unordered_flat_map<std::uint64_t, shard*> tls_shards;
+
+    const auto [it, inserted] = tls_shards.try_emplace(id_, nullptr);
+    if (inserted) {
+        auto owned = std::make_unique<shard>();
+        it->second = owned.get();
+        const std::lock_guard lock(shards_mutex_);
+        shards_.push_back(std::move(owned));
+    }
+    return *it->second;
+}
+
+std::shared_ptr<const static_files::entry> static_files::lookup(std::string_view rel) {
+    auto& sd = local_shard();
+    const auto now = std::chrono::steady_clock::now();
+
+    if (const auto it = sd.files.find(rel); it != sd.files.end()) {
+        if (now < it->second->expires_at) {
+            return it->second;
+        }
+        sd.total_bytes -= it->second->charge;
+        sd.files.erase(it);
+    }
+
+    auto loaded = load(rel);
+    sd.total_bytes += loaded->charge;
+    sd.files.emplace(std::string{rel}, loaded);
+
+    // Over budget: shed the entry closest to expiry -- by construction the least
+    // recently (re)loaded -- until back under. Cold path; a linear scan here beats
+    // maintaining an ordering on every hit.
+    while (sd.total_bytes > opts_.max_cache_bytes_per_thread && sd.files.size() > 1) {
+        auto victim = sd.files.end();
+        for (auto it = sd.files.begin(); it != sd.files.end(); ++it) {
+            if (it->second == loaded) {
+                continue;
+            }
+            if (victim == sd.files.end() ||
+                it->second->expires_at < victim->second->expires_at) {
+                victim = it;
+            }
+        }
+        if (victim == sd.files.end()) {
+            break;
+        }
+        sd.total_bytes -= victim->second->charge;
+        sd.files.erase(victim);
+    }
+
+    return loaded;
+}
+
+std::shared_ptr<const static_files::entry> static_files::load(std::string_view rel) const {
+    const auto now = std::chrono::steady_clock::now();
+    const auto full = fmt::format("{}{}", opts_.root, rel);
+
+    auto mapped = file_mapping::map(full);
+    if (!mapped.has_value()) {
+        auto negative = std::make_shared<entry>();
+        negative->missing = true;
+        negative->expires_at = now + opts_.negative_ttl;
+        return negative;
+    }
+
+    auto& [fm, mtime] = *mapped;
+    auto ent = std::make_shared<entry>();
+    ent->etag = fmt::format("\"{:x}-{:x}\"", static_cast<std::uint64_t>(mtime), fm.size());
+    ent->last_modified = fmt::format("{:%a, %d %b %Y %H:%M:%S} GMT", fmt::gmtime(mtime));
+    ent->content_type = content_type_of(rel);
+    ent->expires_at = now + opts_.entry_ttl;
+    ent->charge = fm.size();
+    ent->body = std::move(fm);
+
+    if (opts_.serve_precompressed) {
+        if (auto gz = file_mapping::map(full + ".gz"); gz.has_value()) {
+            ent->charge += gz->first.size();
+            ent->gzip = std::move(gz->first);
+        }
+        if (auto br = file_mapping::map(full + ".br"); br.has_value()) {
+            ent->charge += br->first.size();
+            ent->brotli = std::move(br->first);
+        }
+    }
+    return ent;
+}
+
+} // namespace fawkes
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/asio/awaitable.hpp>
+
+#include "fawkes/instance_id.hpp"
+
+namespace fawkes {
+
+class request;
+class response;
+class server;
+
+// Serves files under a root directory from per-io-thread caches of memory-mapped
+// entries. Content is mapped once, validators (ETag, Last-Modified) and the content
+// type are computed once at load, and precompressed `.gz`/`.br` siblings are mapped
+// alongside the identity file -- so a cache-hit asset request is a route lookup, a
+// header splice and a gather-write of already-resident bytes. Misses are cached too
+// (negative entries), so a probe for an absent path does not hit the filesystem on
+// every request. Entries are revalidated against the file on a TTL.
+class static_files {
+public:
+    struct options {
+        // Directory request paths are resolved under.
+        std::string root;
+
+        // Cap on mapped bytes per io thread; entries closest to expiry are dropped
+        // once the cap is exceeded. Threads cache independently -- duplicated
+        // mappings buy zero cross-thread coordination, like the other sharded
+        // subsystems.
+        std::size_t max_cache_bytes_per_thread = 64U * 1024U * 1024U;
+
+        // How long an entry serves before the file is consulted again.
+        std::chrono::seconds entry_ttl{60};
+
+        // How long a miss keeps answering 404 without touching the filesystem.
+        std::chrono::seconds negative_ttl{5};
+
+        // Serve a `<file>.gz`/`<file>.br` sibling when Accept-Encoding allows it.
+        bool serve_precompressed{true};
+    };
+
+    explicit static_files(options opts);
+
+    ~static_files();
+
+    // Entries are reached through thread-local pointers keyed by a process-unique
+    // instance id; the subsystem is expected to live as long as the server serving
+    // from it.
+    static_files(const static_files&) = delete;
+    static_files(static_files&&) = delete;
+    static_files& operator=(const static_files&) = delete;
+    static_files& operator=(static_files&&) = delete;
+
+    // Registers the catch-all route GET `<prefix>/*filepath` on `svr`.
+    // `prefix` must not end with a slash and must not be empty: a bare `/*filepath`
+    // would conflict with any root route.
+    void register_at(server& svr, std::string_view prefix);
+
+    // The route handler itself, exposed for wiring up a custom registration.
+    // Expects the requested path, leading slash included, in the `filepath` route
+    // parameter.
+    boost::asio::awaitable<void> serve(const request& req, response& resp);
+
+private:
+    struct entry;
+    struct shard;
+
+    [[nodiscard]] shard& local_shard();
+
+    // Returns the cached entry for `rel`, (re)loading it on a miss or past its TTL.
+    [[nodiscard]] std::shared_ptr<const entry> lookup(std::string_view rel);
+
+    [[nodiscard]] std::shared_ptr<const entry> load(std::string_view rel) const;
+
+    options opts_;
+
+    const std::uint64_t id_ = detail::next_instance_id();
+    mutable std::mutex shards_mutex_;
+    std::vector<std::unique_ptr<shard>> shards_;
+};
+
+} // namespace fawkes
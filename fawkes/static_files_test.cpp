@@ -0,0 +1,245 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <doctest/doctest.h>
+
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+#include "fawkes/static_files.hpp"
+#include "test_utils/run_awaitable_sync.hpp"
+
+namespace {
+
+namespace http = fawkes::http;
+
+// A scratch directory of asset files, wiped on destruction.
+class asset_dir {
+public:
+    asset_dir() {
+        dir_ = std::filesystem::temp_directory_path() / "fawkes_static_files_test";
+        std::filesystem::remove_all(dir_);
+        std::filesystem::create_directory(dir_);
+    }
+
+    ~asset_dir() {
+        std::error_code ec;
+        std::filesystem::remove_all(dir_, ec);
+    }
+
+    asset_dir(const asset_dir&) = delete;
+    asset_dir(asset_dir&&) = delete;
+    asset_dir& operator=(const asset_dir&) = delete;
+    asset_dir& operator=(asset_dir&&) = delete;
+
+    void put(std::string_view rel, std::string_view content) const {
+        std::ofstream out(dir_ / rel, std::ios::binary);
+        out << content;
+    }
+
+    [[nodiscard]] std::string root() const {
+        return dir_.string();
+    }
+
+private:
+    std::filesystem::path dir_;
+};
+
+fawkes::request make_request(std::string_view filepath) {
+    fawkes::request::impl_type raw_req;
+    raw_req.target("/assets/app.js");
+    fawkes::request req(std::move(raw_req));
+    req.params().add("filepath", filepath);
+    return req;
+}
+
+void serve(fawkes::static_files& files, const fawkes::request& req, fawkes::response& resp) {
+    boost::asio::io_context ioc;
+    test_util::run_awaitable_sync(ioc, files.serve(req, resp));
+}
+
+TEST_SUITE_BEGIN("Static Files");
+
+TEST_CASE("Cache hit splices validators and borrows the mapped bytes") {
+    const asset_dir dir;
+    dir.put("app.js", "console.log('hi');");
+
+    fawkes::static_files files({.root = dir.root()});
+    const auto req = make_request("/app.js");
+
+    fawkes::response resp;
+    serve(files, req, resp);
+
+    CHECK_EQ(resp.status(), http::status::ok);
+    CHECK_EQ(resp.header()[http::field::content_type], "text/javascript");
+    CHECK_EQ(resp.header()[http::field::accept_ranges], "bytes");
+    CHECK_FALSE(resp.header()[http::field::etag].empty());
+    CHECK_FALSE(resp.header()[http::field::last_modified].empty());
+    REQUIRE(resp.has_segments());
+    CHECK_EQ(resp.segments().payload_size(), 18);
+
+    SUBCASE("A matching If-None-Match revalidates header-only") {
+        const std::string tag{resp.header()[http::field::etag]};
+
+        fawkes::request::impl_type raw_req;
+        raw_req.target("/assets/app.js");
+        raw_req.set(http::field::if_none_match, tag);
+        fawkes::request cond_req(std::move(raw_req));
+        cond_req.params().add("filepath", "/app.js");
+
+        fawkes::response cond_resp;
+        serve(files, cond_req, cond_resp);
+
+        CHECK_EQ(cond_resp.status(), http::status::not_modified);
+        CHECK_EQ(cond_resp.header()[http::field::etag], tag);
+        CHECK_FALSE(cond_resp.has_segments());
+    }
+}
+
+TEST_CASE("Satisfiable ranges slice the mapping; impossible ones answer 416") {
+    const asset_dir dir;
+    dir.put("app.js", "0123456789");
+
+    fawkes::static_files files({.root = dir.root()});
+
+    SUBCASE("bounded range") {
+        fawkes::request::impl_type raw_req;
+        raw_req.target("/assets/app.js");
+        raw_req.set(http::field::range, "bytes=2-5");
+        fawkes::request req(std::move(raw_req));
+        req.params().add("filepath", "/app.js");
+
+        fawkes::response resp;
+        serve(files, req, resp);
+
+        CHECK_EQ(resp.status(), http::status::partial_content);
+        CHECK_EQ(resp.header()[http::field::content_range], "bytes 2-5/10");
+        REQUIRE(resp.has_segments());
+        CHECK_EQ(resp.segments().payload_size(), 4);
+    }
+
+    SUBCASE("suffix range") {
+        fawkes::request::impl_type raw_req;
+        raw_req.target("/assets/app.js");
+        raw_req.set(http::field::range, "bytes=-3");
+        fawkes::request req(std::move(raw_req));
+        req.params().add("filepath", "/app.js");
+
+        fawkes::response resp;
+        serve(files, req, resp);
+
+        CHECK_EQ(resp.status(), http::status::partial_content);
+        CHECK_EQ(resp.header()[http::field::content_range], "bytes 7-9/10");
+        CHECK_EQ(resp.segments().payload_size(), 3);
+    }
+
+    SUBCASE("range past the end") {
+        fawkes::request::impl_type raw_req;
+        raw_req.target("/assets/app.js");
+        raw_req.set(http::field::range, "bytes=42-");
+        fawkes::request req(std::move(raw_req));
+        req.params().add("filepath", "/app.js");
+
+        fawkes::response resp;
+        serve(files, req, resp);
+
+        CHECK_EQ(resp.status(), http::status::range_not_satisfiable);
+        CHECK_EQ(resp.header()[http::field::content_range], "bytes */10");
+        CHECK_FALSE(resp.has_segments());
+    }
+
+    SUBCASE("multi-part spec is ignored and the full body goes out") {
+        fawkes::request::impl_type raw_req;
+        raw_req.target("/assets/app.js");
+        raw_req.set(http::field::range, "bytes=0-1,4-5");
+        fawkes::request req(std::move(raw_req));
+        req.params().add("filepath", "/app.js");
+
+        fawkes::response resp;
+        serve(files, req, resp);
+
+        CHECK_EQ(resp.status(), http::status::ok);
+        CHECK_EQ(resp.segments().payload_size(), 10);
+    }
+}
+
+TEST_CASE("Misses are cached as negative entries") {
+    const asset_dir dir;
+
+    fawkes::static_files files({.root = dir.root(), .negative_ttl = std::chrono::seconds{60}});
+    const auto req = make_request("/app.js");
+
+    fawkes::response resp;
+    serve(files, req, resp);
+    CHECK_EQ(resp.status(), http::status::not_found);
+
+    // The file shows up afterwards, but the negative entry keeps answering until
+    // its TTL lapses.
+    dir.put("app.js", "console.log('hi');");
+
+    fawkes::response again;
+    serve(files, req, again);
+    CHECK_EQ(again.status(), http::status::not_found);
+}
+
+TEST_CASE("Path traversal never escapes the root") {
+    const asset_dir dir;
+    dir.put("app.js", "console.log('hi');");
+
+    fawkes::static_files files({.root = dir.root()});
+    const auto req = make_request("/../app.js");
+
+    fawkes::response resp;
+    serve(files, req, resp);
+    CHECK_EQ(resp.status(), http::status::not_found);
+}
+
+TEST_CASE("Precompressed siblings are picked by Accept-Encoding") {
+    const asset_dir dir;
+    dir.put("app.js", "console.log('hi');");
+    dir.put("app.js.gz", "<gzipped>");
+
+    fawkes::static_files files({.root = dir.root()});
+
+    fawkes::request::impl_type raw_req;
+    raw_req.target("/assets/app.js");
+    raw_req.set(http::field::accept_encoding, "gzip, br");
+    fawkes::request req(std::move(raw_req));
+    req.params().add("filepath", "/app.js");
+
+    fawkes::response resp;
+    serve(files, req, resp);
+
+    CHECK_EQ(resp.status(), http::status::ok);
+    CHECK_EQ(resp.header()[http::field::content_encoding], "gzip");
+    CHECK_EQ(resp.header()[http::field::vary], "Accept-Encoding");
+    // The sibling's bytes, not a recompression of the identity file.
+    CHECK_EQ(resp.segments().payload_size(), 9);
+
+    SUBCASE("identity is served when the client cannot decode it") {
+        fawkes::request::impl_type plain_raw;
+        plain_raw.target("/assets/app.js");
+        fawkes::request plain_req(std::move(plain_raw));
+        plain_req.params().add("filepath", "/app.js");
+
+        fawkes::response plain_resp;
+        serve(files, plain_req, plain_resp);
+
+        CHECK_EQ(plain_resp.header()[http::field::content_encoding], "");
+        CHECK_EQ(plain_resp.segments().payload_size(), 18);
+    }
+}
+
+TEST_SUITE_END();
+
+} // namespace
@@ -0,0 +1,254 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include <boost/beast/http/verb.hpp>
+
+#include "fawkes/path_params.hpp"
+#include "fawkes/router.hpp"
+#include "fawkes/tree.hpp"
+
+namespace fawkes {
+
+namespace detail {
+
+// NTTP-usable string literal.
+template<std::size_t N>
+struct fixed_string {
+    std::array<char, N> chars{};
+
+    // NOLINTNEXTLINE(google-explicit-constructor): the whole point is literal deduction.
+    consteval fixed_string(const char (&str)[N]) { // NOLINT(*-avoid-c-arrays)
+        std::copy_n(static_cast<const char*>(str), N, chars.begin());
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept {
+        return {chars.data(), N - 1};
+    }
+};
+
+// Pops the leading '/'-prefixed segment off `path` and returns it without the slash.
+constexpr std::string_view next_segment(std::string_view& path) noexcept {
+    path.remove_prefix(1);
+    const auto pos = path.find('/');
+    const auto segment = path.substr(0, pos);
+    path = pos == std::string_view::npos ? std::string_view{} : path.substr(pos);
+    return segment;
+}
+
+// Accepts the same grammar `node::add_route()` accepts: segments may embed one `:param`
+// taking the rest of the segment, and `*catch_all` must be a whole trailing segment.
+consteval bool valid_route_path(std::string_view path) {
+    if (path.empty() || path.front() != '/') {
+        return false;
+    }
+
+    auto rest = path;
+    std::size_t consumed = 0;
+    while (true) {
+        const auto wc = find_wildcard(rest);
+        if (!wc.found()) {
+            return true;
+        }
+        if (!wc.valid_name()) {
+            return false;
+        }
+        if (wc.name.front() == '*') {
+            const auto abs_pos = consumed + wc.pos;
+            if (abs_pos == 0 || path[abs_pos - 1] != '/' ||
+                wc.pos + wc.name.size() != rest.size()) {
+                return false;
+            }
+        }
+        rest.remove_prefix(wc.pos + wc.name.size());
+        consumed += wc.pos + wc.name.size();
+    }
+}
+
+// True if some concrete path could match both segments.
+consteval bool segments_overlap(std::string_view sa, std::string_view sb) {
+    const auto wa = sa.find_first_of(":*");
+    const auto wb = sb.find_first_of(":*");
+    if (wa == std::string_view::npos && wb == std::string_view::npos) {
+        return sa == sb;
+    }
+
+    const auto prefix_a = sa.substr(0, wa);
+    const auto prefix_b = sb.substr(0, wb);
+    if (wa == std::string_view::npos) {
+        return sa.starts_with(prefix_b);
+    }
+    if (wb == std::string_view::npos) {
+        return sb.starts_with(prefix_a);
+    }
+    return prefix_a.starts_with(prefix_b) || prefix_b.starts_with(prefix_a);
+}
+
+// True if some concrete path could match both patterns, i.e. registering both would be
+// ambiguous.
+consteval bool patterns_conflict(std::string_view pa, std::string_view pb) {
+    while (!pa.empty() && !pb.empty()) {
+        const auto sa = next_segment(pa);
+        const auto sb = next_segment(pb);
+        if (sa.starts_with('*') || sb.starts_with('*')) {
+            return true;
+        }
+        if (!segments_overlap(sa, sb)) {
+            return false;
+        }
+    }
+    return pa.empty() && pb.empty();
+}
+
+// Matches `path` against `pattern`; wildcard values are captured only by
+// `extract_params()` once a match is confirmed, so a failed attempt leaves no
+// partially filled params behind.
+constexpr bool match_pattern(std::string_view pattern, std::string_view path) noexcept {
+    while (true) {
+        if (pattern.empty()) {
+            return path.empty();
+        }
+        if (path.empty()) {
+            return false;
+        }
+
+        const auto seg_p = next_segment(pattern);
+        if (seg_p.starts_with('*')) {
+            return true;
+        }
+
+        const auto seg_t = next_segment(path);
+        const auto wc = seg_p.find(':');
+        if (wc == std::string_view::npos) {
+            if (seg_p != seg_t) {
+                return false;
+            }
+        } else if (!seg_t.starts_with(seg_p.substr(0, wc))) {
+            return false;
+        }
+    }
+}
+
+// `pattern` must have matched `path`; see `match_pattern()`.
+constexpr void extract_params(std::string_view pattern, std::string_view path,
+                              path_params& ps) {
+    while (!pattern.empty()) {
+        const auto rest = path;
+        const auto seg_p = next_segment(pattern);
+        if (seg_p.starts_with('*')) {
+            ps.add(seg_p.substr(1), rest);
+            return;
+        }
+
+        const auto seg_t = next_segment(path);
+        if (const auto wc = seg_p.find(':'); wc != std::string_view::npos) {
+            ps.add(seg_p.substr(wc + 1), seg_t.substr(wc));
+        }
+    }
+}
+
+// True if no two routes with the same verb could both match some concrete path.
+template<typename... Routes>
+consteval bool conflict_free() {
+    constexpr std::size_t n = sizeof...(Routes);
+    const std::array<boost::beast::http::verb, n> verbs{Routes::verb...};
+    const std::array<std::string_view, n> paths{Routes::path...};
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i + 1; j < n; ++j) {
+            if (verbs[i] == verbs[j] && patterns_conflict(paths[i], paths[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+// A compile-time declared route; see `static_router`.
+template<boost::beast::http::verb V, detail::fixed_string Path>
+struct route {
+    static constexpr auto verb = V;
+    static constexpr std::string_view path = Path.view();
+};
+
+// A router whose dispatch structure is generated entirely at compile time from routes
+// declared as NTTP string literals: path validation and conflict detection are
+// static_asserts, the match table lives in one contiguous constexpr array, and lookups
+// perform no heap allocation and no tree walk.
+// Handlers are attached positionally at construction, in route declaration order, and
+// middlewares are not supported; routes needing them belong on the runtime `router`.
+// Exposes the same `locate_route()` contract as `router` and can be plugged into one
+// via `router::set_locator()`.
+template<typename... Routes>
+class static_router {
+public:
+    static constexpr std::size_t num_routes = sizeof...(Routes);
+    static_assert(num_routes > 0);
+    static_assert((detail::valid_route_path(Routes::path) && ...),
+                  "invalid route path; check wildcard syntax");
+    static_assert(detail::conflict_free<Routes...>(), "conflicting route paths");
+
+    template<is_user_handler... Hs>
+        requires(sizeof...(Hs) == num_routes)
+    explicit static_router(Hs&&... handlers)
+        : entries_{route_entry{.direct = std::forward<Hs>(handlers)}...} {}
+
+    // `path` must outlive `ps`.
+    [[nodiscard]] const route_entry* locate_route(boost::beast::http::verb verb,
+                                                  std::string_view path,
+                                                  path_params& ps) const {
+        for (std::size_t i = 0; i < num_routes; ++i) {
+            const auto& meta = table[i];
+            if (meta.verb != verb) {
+                continue;
+            }
+
+            if (!meta.has_wildcard) {
+                if (meta.path == path) {
+                    return &entries_[i];
+                }
+                continue;
+            }
+
+            if (detail::match_pattern(meta.path, path)) {
+                detail::extract_params(meta.path, path, ps);
+                return &entries_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] route_locator locator() const noexcept {
+        return {.table = this,
+                .locate = [](const void* table, boost::beast::http::verb verb,
+                             std::string_view path, path_params& ps) -> const route_entry* {
+                    return static_cast<const static_router*>(table)->locate_route(verb, path,
+                                                                                  ps);
+                }};
+    }
+
+private:
+    struct route_meta {
+        boost::beast::http::verb verb;
+        std::string_view path;
+        bool has_wildcard;
+    };
+
+    static constexpr std::array<route_meta, num_routes> table{
+        route_meta{.verb = Routes::verb,
+                   .path = Routes::path,
+                   .has_wildcard = detail::find_wildcard(Routes::path).found()}...};
+
+    std::array<route_entry, num_routes> entries_;
+};
+
+} // namespace fawkes
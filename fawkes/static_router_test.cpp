@@ -0,0 +1,113 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <string>
+#include <string_view>
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <doctest/doctest.h>
+#include <esl/ignore_unused.h>
+
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+#include "fawkes/router.hpp"
+#include "fawkes/static_router.hpp"
+
+namespace {
+
+namespace asio = boost::asio;
+namespace http = boost::beast::http;
+
+auto make_marker(std::string& hit, std::string_view mark) {
+    return [&hit, mark](const fawkes::request&, fawkes::response&) -> asio::awaitable<void> {
+        hit = mark;
+        co_return;
+    };
+}
+
+TEST_SUITE_BEGIN("Static Router");
+
+TEST_CASE("Compile-time path helpers") {
+    using fawkes::detail::match_pattern;
+    using fawkes::detail::patterns_conflict;
+    using fawkes::detail::valid_route_path;
+
+    static_assert(valid_route_path("/users/:id"));
+    static_assert(valid_route_path("/user_:name/about"));
+    static_assert(valid_route_path("/src/*filepath"));
+    static_assert(!valid_route_path("users"));
+    static_assert(!valid_route_path("/a/:"));
+    static_assert(!valid_route_path("/a/*files/b"));
+    static_assert(!valid_route_path("/a*files"));
+
+    static_assert(patterns_conflict("/users/:id", "/users/admin"));
+    static_assert(patterns_conflict("/src/*fp", "/src/a/b"));
+    static_assert(!patterns_conflict("/users/:id", "/groups/:id"));
+    static_assert(!patterns_conflict("/doc", "/doc/"));
+
+    static_assert(match_pattern("/users/:id", "/users/42"));
+    static_assert(match_pattern("/user_:name", "/user_kc"));
+    static_assert(!match_pattern("/users/:id", "/users/42/posts"));
+    static_assert(match_pattern("/src/*filepath", "/src/a/b.png"));
+}
+
+TEST_CASE("Locate routes") {
+    using router_type = fawkes::static_router<fawkes::route<http::verb::get, "/health">,
+                                              fawkes::route<http::verb::get, "/users/:id">,
+                                              fawkes::route<http::verb::post, "/users">,
+                                              fawkes::route<http::verb::get, "/src/*filepath">>;
+
+    std::string hit;
+    const router_type router(make_marker(hit, "health"),
+                             make_marker(hit, "user"),
+                             make_marker(hit, "create-user"),
+                             make_marker(hit, "src"));
+
+    fawkes::path_params params;
+
+    SUBCASE("static path") {
+        const auto* entry = router.locate_route(http::verb::get, "/health", params);
+        REQUIRE_NE(entry, nullptr);
+        CHECK(entry->direct);
+    }
+
+    SUBCASE("param path") {
+        const auto* entry = router.locate_route(http::verb::get, "/users/42", params);
+        REQUIRE_NE(entry, nullptr);
+        CHECK_EQ(params.get("id"), "42");
+    }
+
+    SUBCASE("catch-all path") {
+        const auto* entry = router.locate_route(http::verb::get, "/src/js/app.js", params);
+        REQUIRE_NE(entry, nullptr);
+        CHECK_EQ(params.get("filepath"), "/js/app.js");
+    }
+
+    SUBCASE("verb mismatch") {
+        CHECK_EQ(router.locate_route(http::verb::post, "/health", params), nullptr);
+    }
+
+    SUBCASE("no such path") {
+        CHECK_EQ(router.locate_route(http::verb::get, "/nope", params), nullptr);
+    }
+}
+
+TEST_CASE("Plugs into a runtime router") {
+    const fawkes::static_router<fawkes::route<http::verb::get, "/ping">> table(
+        [](const fawkes::request&, fawkes::response&) -> asio::awaitable<void> {
+            co_return;
+        });
+
+    fawkes::router router;
+    router.set_locator(table.locator());
+
+    fawkes::path_params params;
+    CHECK_NE(router.locate_route(http::verb::get, "/ping", params), nullptr);
+    CHECK_EQ(router.locate_route(http::verb::get, "/pong", params), nullptr);
+}
+
+TEST_SUITE_END(); // Static Router
+
+} // namespace
@@ -0,0 +1,74 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace fawkes::detail {
+
+// Word-at-a-time (SWAR) string kernels shared by the per-request hot scans: the
+// router tree walk and cookie-header parsing. Portable across ISAs with no dispatch;
+// the SWAR paths are guarded to little-endian and every kernel keeps a scalar
+// tail/fallback.
+
+inline constexpr std::uint64_t swar_ones = 0x0101010101010101ULL;
+inline constexpr std::uint64_t swar_highs = 0x8080808080808080ULL;
+
+// Locates the next `needle` eight bytes at a time (zero-byte trick on the xor-ed
+// word). Returns `hay.size()` when there is none.
+[[nodiscard]] inline std::size_t find_byte(std::string_view hay, char needle,
+                                           std::size_t from = 0) noexcept {
+    std::size_t i = from;
+    if constexpr (std::endian::native == std::endian::little) {
+        const auto pattern = swar_ones * static_cast<std::uint8_t>(needle);
+        for (; i + sizeof(std::uint64_t) <= hay.size(); i += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, hay.data() + i, sizeof(word));
+            word ^= pattern;
+            // Set high bit of every byte that matched -- i.e. is now zero.
+            const auto found = (word - swar_ones) & ~word & swar_highs;
+            if (found != 0) {
+                return i + static_cast<std::size_t>(std::countr_zero(found)) / 8U;
+            }
+        }
+    }
+
+    const auto pos = hay.find(needle, i);
+    return pos == std::string_view::npos ? hay.size() : pos;
+}
+
+// Returns length of common prefix, comparing eight bytes per step.
+[[nodiscard]] constexpr std::size_t longest_common_prefix(std::string_view s1,
+                                                          std::string_view s2) noexcept {
+    const std::size_t limit = std::min(s1.size(), s2.size());
+    std::size_t i = 0;
+
+    if (!std::is_constant_evaluated()) {
+        if constexpr (std::endian::native == std::endian::little) {
+            for (; i + sizeof(std::uint64_t) <= limit; i += sizeof(std::uint64_t)) {
+                std::uint64_t w1;
+                std::uint64_t w2;
+                std::memcpy(&w1, s1.data() + i, sizeof(w1));
+                std::memcpy(&w2, s2.data() + i, sizeof(w2));
+                if (const auto diff = w1 ^ w2; diff != 0) {
+                    return i + static_cast<std::size_t>(std::countr_zero(diff)) / 8U;
+                }
+            }
+        }
+    }
+
+    while (i < limit && s1[i] == s2[i]) {
+        ++i;
+    }
+    return i;
+}
+
+} // namespace fawkes::detail
@@ -0,0 +1,38 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <string>
+#include <string_view>
+
+#include <doctest/doctest.h>
+
+#include "fawkes/swar.hpp"
+
+namespace {
+
+TEST_SUITE_BEGIN("SWAR Kernels");
+
+TEST_CASE("Find byte across word boundaries") {
+    const std::string hay = std::string(13, 'a') + ';' + std::string(9, 'b');
+    CHECK_EQ(fawkes::detail::find_byte(hay, ';'), 13);
+    CHECK_EQ(fawkes::detail::find_byte(hay, ';', 14), hay.size());
+    CHECK_EQ(fawkes::detail::find_byte("short", ';'), 5);
+    CHECK_EQ(fawkes::detail::find_byte("", ';'), 0);
+}
+
+TEST_CASE("Longest common prefix") {
+    using fawkes::detail::longest_common_prefix;
+
+    CHECK_EQ(longest_common_prefix("/api/v1/users", "/api/v1/users"), 13);
+    CHECK_EQ(longest_common_prefix("/api/v1/users", "/api/v2/users"), 6);
+    CHECK_EQ(longest_common_prefix("/short", "/short/and/longer"), 6);
+    CHECK_EQ(longest_common_prefix("abc", "xyz"), 0);
+    CHECK_EQ(longest_common_prefix("", "anything"), 0);
+
+    static_assert(longest_common_prefix("/static", "/statue") == 5);
+}
+
+TEST_SUITE_END(); // SWAR Kernels
+
+} // namespace
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/timing_wheel.hpp"
+
+#include <boost/system/error_code.hpp>
+
+namespace fawkes {
+
+void timing_wheel::arm(detail::wheel_entry& entry, clock_type::duration timeout) {
+    if (entry.armed) {
+        disarm(entry);
+    }
+
+    if (timeout.count() <= 0) {
+        return;
+    }
+
+    // Round up so a deadline never fires early.
+    const auto ticks =
+        static_cast<std::size_t>((timeout + tick_ - clock_type::duration{1}) / tick_);
+    entry.slot = (current_slot_ + ticks) % num_slots;
+    entry.remaining_laps = (ticks - 1) / num_slots;
+    entry.armed = true;
+
+    auto& slot = slots_[entry.slot];
+    slot.push_front(&entry);
+    entry.pos = slot.begin();
+
+    ++armed_count_;
+    if (!ticking_) {
+        ticking_ = true;
+        schedule_tick();
+    }
+}
+
+void timing_wheel::disarm(detail::wheel_entry& entry) noexcept {
+    if (!entry.armed) {
+        return;
+    }
+
+    slots_[entry.slot].erase(entry.pos);
+    entry.armed = false;
+    --armed_count_;
+}
+
+void timing_wheel::tick() {
+    current_slot_ = (current_slot_ + 1) % num_slots;
+
+    auto& slot = slots_[current_slot_];
+    for (auto it = slot.begin(); it != slot.end();) {
+        auto& entry = **it;
+        if (entry.remaining_laps > 0) {
+            --entry.remaining_laps;
+            ++it;
+            continue;
+        }
+
+        it = slot.erase(it);
+        entry.armed = false;
+        --armed_count_;
+        entry.on_expiry();
+    }
+}
+
+void timing_wheel::schedule_tick() {
+    if (armed_count_ == 0) {
+        // Let the io context run down instead of ticking an empty wheel forever.
+        ticking_ = false;
+        return;
+    }
+
+    driver_.expires_after(tick_);
+    driver_.async_wait([this](boost::system::error_code ec) {
+        if (ec) {
+            ticking_ = false;
+            return;
+        }
+
+        tick();
+        schedule_tick();
+    });
+}
+
+} // namespace fawkes
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+namespace fawkes {
+
+namespace asio = boost::asio;
+
+namespace detail {
+
+struct wheel_entry {
+    std::function<void()> on_expiry;
+    std::size_t slot{0};
+    std::size_t remaining_laps{0};
+    bool armed{false};
+    std::list<wheel_entry*>::iterator pos;
+};
+
+} // namespace detail
+
+// A coarse-grained timer wheel shared by sessions running on the same io thread.
+// Arming or re-arming a deadline is an O(1) bucket move instead of a per-stream asio
+// timer operation, which matters when every request re-arms its timeouts several times.
+// Deadlines are rounded up to the tick granularity, and deadlines beyond one full
+// rotation are carried over via lap counters.
+// The wheel ticks only while at least one timer is armed.
+// Instances are not thread-safe; use `local()` to access the wheel of the calling thread.
+class timing_wheel {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr std::chrono::milliseconds default_tick{100};
+    static constexpr std::size_t num_slots = 512U;
+
+    // Movable registration handle; cancels the deadline on destruction.
+    // Must not outlive its wheel.
+    class timer {
+    public:
+        timer(timing_wheel& wheel, std::unique_ptr<detail::wheel_entry> entry) noexcept
+            : wheel_(&wheel),
+              entry_(std::move(entry)) {}
+
+        ~timer() {
+            if (entry_) {
+                wheel_->disarm(*entry_);
+            }
+        }
+
+        timer(timer&&) noexcept = default;
+
+        // The destination's entry must be disarmed before it is destroyed, or its
+        // slot would keep a pointer to the freed entry until the next tick.
+        timer& operator=(timer&& other) noexcept {
+            if (this != &other) {
+                if (entry_) {
+                    wheel_->disarm(*entry_);
+                }
+                wheel_ = other.wheel_;
+                entry_ = std::move(other.entry_);
+            }
+            return *this;
+        }
+
+        timer(const timer&) = delete;
+        timer& operator=(const timer&) = delete;
+
+        // Arms, or re-arms, the deadline; the expiry callback fires about `timeout`
+        // later, subject to the tick granularity.
+        void expires_after(clock_type::duration timeout) {
+            wheel_->arm(*entry_, timeout);
+        }
+
+        void cancel() noexcept {
+            wheel_->disarm(*entry_);
+        }
+
+    private:
+        timing_wheel* wheel_;
+        std::unique_ptr<detail::wheel_entry> entry_;
+    };
+
+    explicit timing_wheel(asio::any_io_executor executor,
+                          std::chrono::milliseconds tick = default_tick)
+        : tick_(tick),
+          driver_(std::move(executor)),
+          slots_(num_slots) {}
+
+    ~timing_wheel() = default;
+
+    timing_wheel(const timing_wheel&) = delete;
+    timing_wheel(timing_wheel&&) = delete;
+    timing_wheel& operator=(const timing_wheel&) = delete;
+    timing_wheel& operator=(timing_wheel&&) = delete;
+
+    // `on_expiry` is invoked on the wheel's executor and must not throw.
+    [[nodiscard]] timer make_timer(std::function<void()> on_expiry) {
+        auto entry = std::make_unique<detail::wheel_entry>();
+        entry->on_expiry = std::move(on_expiry);
+        return {*this, std::move(entry)};
+    }
+
+    [[nodiscard]] std::size_t armed_count() const noexcept {
+        return armed_count_;
+    }
+
+    // Returns the wheel of the calling thread, creating it on first use.
+    // The `executor` must be running on the calling thread.
+    static timing_wheel& local(const asio::any_io_executor& executor) {
+        static thread_local timing_wheel instance(executor);
+        return instance;
+    }
+
+private:
+    void arm(detail::wheel_entry& entry, clock_type::duration timeout);
+
+    void disarm(detail::wheel_entry& entry) noexcept;
+
+    void tick();
+
+    void schedule_tick();
+
+    std::chrono::milliseconds tick_;
+    asio::steady_timer driver_;
+    std::vector<std::list<detail::wheel_entry*>> slots_;
+    std::size_t current_slot_{0};
+    std::size_t armed_count_{0};
+    bool ticking_{false};
+};
+
+} // namespace fawkes
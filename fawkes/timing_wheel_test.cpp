@@ -0,0 +1,103 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <chrono>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/io_context.hpp>
+
+#include "fawkes/timing_wheel.hpp"
+
+namespace {
+
+namespace asio = boost::asio;
+
+using namespace std::chrono_literals;
+
+TEST_SUITE_BEGIN("Timing Wheel");
+
+TEST_CASE("Expiry fires after the deadline") {
+    asio::io_context ctx;
+    fawkes::timing_wheel wheel(ctx.get_executor(), 2ms);
+
+    bool fired = false;
+    auto timer = wheel.make_timer([&fired] {
+        fired = true;
+    });
+    timer.expires_after(10ms);
+
+    const auto start = std::chrono::steady_clock::now();
+    // Returns once the wheel has no armed timer left.
+    ctx.run();
+
+    CHECK(fired);
+    CHECK_GE(std::chrono::steady_clock::now() - start, 10ms);
+    CHECK_EQ(wheel.armed_count(), 0);
+}
+
+TEST_CASE("Cancelled timer never fires") {
+    asio::io_context ctx;
+    fawkes::timing_wheel wheel(ctx.get_executor(), 2ms);
+
+    bool fired = false;
+    auto timer = wheel.make_timer([&fired] {
+        fired = true;
+    });
+    timer.expires_after(10ms);
+    timer.cancel();
+
+    ctx.run();
+
+    CHECK_FALSE(fired);
+}
+
+TEST_CASE("Re-arming moves the deadline") {
+    asio::io_context ctx;
+    fawkes::timing_wheel wheel(ctx.get_executor(), 2ms);
+
+    bool fired = false;
+    auto timer = wheel.make_timer([&fired] {
+        fired = true;
+    });
+    timer.expires_after(4ms);
+    timer.expires_after(20ms);
+    CHECK_EQ(wheel.armed_count(), 1);
+
+    const auto start = std::chrono::steady_clock::now();
+    ctx.run();
+
+    CHECK(fired);
+    CHECK_GE(std::chrono::steady_clock::now() - start, 20ms);
+}
+
+TEST_CASE("Move assignment disarms the replaced timer") {
+    asio::io_context ctx;
+    fawkes::timing_wheel wheel(ctx.get_executor(), 2ms);
+
+    bool first_fired = false;
+    auto timer = wheel.make_timer([&first_fired] {
+        first_fired = true;
+    });
+    timer.expires_after(5ms);
+
+    bool second_fired = false;
+    auto replacement = wheel.make_timer([&second_fired] {
+        second_fired = true;
+    });
+    replacement.expires_after(20ms);
+
+    // The armed first entry must leave its slot before it is destroyed.
+    timer = std::move(replacement);
+    CHECK_EQ(wheel.armed_count(), 1);
+
+    ctx.run();
+
+    CHECK_FALSE(first_fired);
+    CHECK(second_fired);
+}
+
+TEST_SUITE_END(); // Timing Wheel
+
+} // namespace
@@ -0,0 +1,20 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#if defined(FAWKES_ENABLE_TLS)
+
+#include <boost/asio/ssl/stream.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+
+namespace fawkes {
+
+// Transport of a TLS session: the ssl engine layered over the same `tcp_stream` the
+// plaintext path uses, so everything above the handshake behaves identically.
+using tls_stream = boost::asio::ssl::stream<boost::beast::tcp_stream>;
+
+} // namespace fawkes
+
+#endif // defined(FAWKES_ENABLE_TLS)
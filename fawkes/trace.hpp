@@ -0,0 +1,109 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "fawkes/small_function.hpp"
+
+namespace fawkes {
+
+// Phase timestamps for one request, recorded at fixed points on the serve path and
+// handed to the sink registered via `server::set_trace_sink()` once the response has
+// drained. The whole facility is compiled out unless FAWKES_ENABLE_TRACING is defined:
+// every member below collapses to a no-op and `armed()` is constant false, so guarded
+// call sites fold away entirely.
+class request_trace {
+public:
+    using clock = std::chrono::steady_clock;
+
+    enum class point : std::uint8_t {
+        header_done = 0, // Request line and headers parsed.
+        read_done,       // Full body buffered, or handed off to a streaming route.
+        routed,          // Route located and path params bound.
+        handled,         // Middlewares and the handler produced the response.
+        write_done,      // Response fully drained to the socket.
+    };
+
+    static constexpr std::size_t num_points = 5;
+
+    // Arms the trace for the next request; a disarmed trace records nothing.
+    void arm() noexcept {
+#if defined(FAWKES_ENABLE_TRACING)
+        armed_ = true;
+        started_at_ = {};
+        points_.fill({});
+#endif
+    }
+
+    void disarm() noexcept {
+#if defined(FAWKES_ENABLE_TRACING)
+        armed_ = false;
+#endif
+    }
+
+    [[nodiscard]] bool armed() const noexcept {
+#if defined(FAWKES_ENABLE_TRACING)
+        return armed_;
+#else
+        return false;
+#endif
+    }
+
+    void begin(clock::time_point started_at) noexcept {
+#if defined(FAWKES_ENABLE_TRACING)
+        if (armed_) {
+            started_at_ = started_at;
+        }
+#else
+        static_cast<void>(started_at);
+#endif
+    }
+
+    void mark(point pt) noexcept {
+#if defined(FAWKES_ENABLE_TRACING)
+        if (armed_) {
+            points_[static_cast<std::size_t>(pt)] = clock::now();
+        }
+#else
+        static_cast<void>(pt);
+#endif
+    }
+
+    // First octets of the request on the wire.
+    [[nodiscard]] clock::time_point started_at() const noexcept {
+#if defined(FAWKES_ENABLE_TRACING)
+        return started_at_;
+#else
+        return {};
+#endif
+    }
+
+    // Zero for points the request never reached.
+    [[nodiscard]] clock::time_point at(point pt) const noexcept {
+#if defined(FAWKES_ENABLE_TRACING)
+        return points_[static_cast<std::size_t>(pt)];
+#else
+        static_cast<void>(pt);
+        return {};
+#endif
+    }
+
+private:
+#if defined(FAWKES_ENABLE_TRACING)
+    bool armed_{false};
+    clock::time_point started_at_{};
+    std::array<clock::time_point, num_points> points_{};
+#endif
+};
+
+// Invoked on the session's io thread right after the traced response drains; keep it
+// cheap or ship the copy elsewhere.
+using trace_sink_t = small_function<void(const request_trace&)>;
+
+} // namespace fawkes
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include <chrono>
+
+#include <doctest/doctest.h>
+
+#include "fawkes/trace.hpp"
+
+namespace {
+
+using fawkes::request_trace;
+
+TEST_SUITE_BEGIN("Request Trace");
+
+TEST_CASE("Armed trace records points in order") {
+    request_trace trace;
+    trace.arm();
+    trace.begin(request_trace::clock::now());
+    trace.mark(request_trace::point::header_done);
+    trace.mark(request_trace::point::read_done);
+    trace.mark(request_trace::point::handled);
+
+#if defined(FAWKES_ENABLE_TRACING)
+    CHECK(trace.armed());
+    CHECK_NE(trace.started_at(), request_trace::clock::time_point{});
+    CHECK_GE(trace.at(request_trace::point::read_done),
+             trace.at(request_trace::point::header_done));
+    CHECK_GE(trace.at(request_trace::point::handled),
+             trace.at(request_trace::point::read_done));
+    // Never reached.
+    CHECK_EQ(trace.at(request_trace::point::write_done),
+             request_trace::clock::time_point{});
+
+    SUBCASE("Re-arming wipes the previous request") {
+        trace.arm();
+        CHECK_EQ(trace.started_at(), request_trace::clock::time_point{});
+        CHECK_EQ(trace.at(request_trace::point::handled),
+                 request_trace::clock::time_point{});
+    }
+#else
+    // Compiled out: every call above is a no-op.
+    CHECK_FALSE(trace.armed());
+    CHECK_EQ(trace.started_at(), request_trace::clock::time_point{});
+    CHECK_EQ(trace.at(request_trace::point::handled),
+             request_trace::clock::time_point{});
+#endif
+}
+
+TEST_CASE("Disarmed trace records nothing") {
+    request_trace trace;
+    trace.arm();
+    trace.disarm();
+    trace.begin(request_trace::clock::now());
+    trace.mark(request_trace::point::header_done);
+
+    CHECK_FALSE(trace.armed());
+    CHECK_EQ(trace.started_at(), request_trace::clock::time_point{});
+    CHECK_EQ(trace.at(request_trace::point::header_done),
+             request_trace::clock::time_point{});
+}
+
+TEST_SUITE_END(); // Request Trace
+
+} // namespace
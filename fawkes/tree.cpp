@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <deque>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -16,9 +17,9 @@
 
 namespace fawkes {
 
-const route_handler_t* node::locate(std::string_view path, path_params& ps) const {
+const route_entry* node::locate(std::string_view path, path_params& ps) const {
     if (path.size() == path_.size()) {
-        return handler_ ? &handler_ : nullptr;
+        return entry_ ? &entry_ : nullptr;
     }
 
     if (path.size() > path_.size() && path.starts_with(path_)) {
@@ -40,7 +41,7 @@ const route_handler_t* node::locate(std::string_view path, path_params& ps) cons
             ps.add(std::string_view{child.path_}.substr(1), path.substr(0, param_end));
 
             if (param_end == std::string_view::npos) {
-                return child.handler_ ? &child.handler_ : nullptr;
+                return child.entry_ ? &child.entry_ : nullptr;
             }
 
             // Go deeper.
@@ -49,7 +50,7 @@ const route_handler_t* node::locate(std::string_view path, path_params& ps) cons
             }
         } else if (child.type_ == type::catch_all) {
             ps.add(std::string_view{child.path_}.substr(2), path);
-            return &child.handler_;
+            return &child.entry_;
         } else [[unlikely]] {
             throw std::runtime_error(fmt::format("node type '{}' of route '{}' is invalid",
                                                  esl::to_underlying(child.type_), child.path_));
@@ -60,7 +61,7 @@ const route_handler_t* node::locate(std::string_view path, path_params& ps) cons
 }
 
 void node::insert_route(std::string_view path, std::string_view full_path,
-                        route_handler_t&& handler) {
+                        route_entry&& entry) {
     const auto len = detail::longest_common_prefix(path, path_);
 
     // Split current node to make node path equal to common prefix.
@@ -72,7 +73,7 @@ void node::insert_route(std::string_view path, std::string_view full_path,
         child->type_ = type::plain;
         child->priority_ = priority_ - 1;
         child->children_ = std::move(children_);
-        child->handler_ = std::move(handler_);
+        child->entry_ = std::move(entry_);
 
         children_.clear(); // Reset to known state for reuse.
         children_.push_back(std::move(child));
@@ -83,11 +84,11 @@ void node::insert_route(std::string_view path, std::string_view full_path,
 
     // `path` is subset of a route path denoted by current node.
     if (len == path.size()) {
-        if (handler_) [[unlikely]] {
+        if (entry_) [[unlikely]] {
             throw std::invalid_argument(
                 fmt::format("a handler is already registered for path '{}'", full_path));
         }
-        handler_ = std::move(handler);
+        entry_ = std::move(entry);
         return;
     }
 
@@ -100,7 +101,7 @@ void node::insert_route(std::string_view path, std::string_view full_path,
         if (path.starts_with(child.path_) &&
             child.type_ != type::catch_all &&
             (child.path_.size() == path.size() || path[child.path_.size()] == '/')) {
-            child.insert_route(path, full_path, std::move(handler));
+            child.insert_route(path, full_path, std::move(entry));
             return;
         }
 
@@ -123,7 +124,7 @@ void node::insert_route(std::string_view path, std::string_view full_path,
         assert(children_.size() == 1);
         auto& child = *children_.front();
         ++child.priority_;
-        child.insert_route(path, full_path, std::move(handler));
+        child.insert_route(path, full_path, std::move(entry));
         return;
     }
 
@@ -131,7 +132,7 @@ void node::insert_route(std::string_view path, std::string_view full_path,
     for (std::size_t i = 0; i < indices_.size(); ++i) {
         if (const auto c = indices_[i]; c == idxc) {
             i = increment_child_priority(i);
-            children_[i]->insert_route(path, full_path, std::move(handler));
+            children_[i]->insert_route(path, full_path, std::move(entry));
             return;
         }
     }
@@ -141,22 +142,22 @@ void node::insert_route(std::string_view path, std::string_view full_path,
         children_.push_back(std::make_unique<node>());
         auto& child = *children_.back();
         esl::ignore_unused(increment_child_priority(indices_.size() - 1));
-        child.insert_path(path, full_path, detail::unknown_wildcard, std::move(handler));
+        child.insert_path(path, full_path, detail::unknown_wildcard, std::move(entry));
         return;
     }
 
-    insert_path(path, full_path, detail::unknown_wildcard, std::move(handler));
+    insert_path(path, full_path, detail::unknown_wildcard, std::move(entry));
 }
 
 void node::insert_path(std::string_view path, std::string_view full_path,
-                       detail::wildcard_result wildcard, route_handler_t&& handler) {
+                       detail::wildcard_result wildcard, route_entry&& entry) {
     // The invocation with no wildcard means we haven't scanned the `path` yet.
     // Let's scan the path in flight.
     if (!wildcard.found()) {
         wildcard = detail::find_wildcard(path);
         if (!wildcard.found()) {
             path_ = path;
-            handler_ = std::move(handler);
+            entry_ = std::move(entry);
             return;
         }
 
@@ -190,7 +191,7 @@ void node::insert_path(std::string_view path, std::string_view full_path,
 
         // The path ends with the wildcard, the param node is the leaf.
         if (path.size() == wildcard.name.size()) {
-            child.handler_ = std::move(handler);
+            child.entry_ = std::move(entry);
             return;
         }
 
@@ -201,7 +202,7 @@ void node::insert_path(std::string_view path, std::string_view full_path,
         grand_child.insert_path(path.substr(wildcard.name.size()),
                                 full_path,
                                 detail::unknown_wildcard,
-                                std::move(handler));
+                                std::move(entry));
     } else {
         if (wildcard.pos + wildcard.name.size() != path.size()) {
             throw std::invalid_argument(fmt::format(
@@ -235,7 +236,7 @@ void node::insert_path(std::string_view path, std::string_view full_path,
         grand_child->path_ = path.substr(wildcard.pos);
         grand_child->type_ = type::catch_all;
         grand_child->priority_ = 1;
-        grand_child->handler_ = std::move(handler);
+        grand_child->entry_ = std::move(entry);
 
         child->children_.push_back(std::move(grand_child));
         children_.push_back(std::move(child));
@@ -243,6 +244,119 @@ void node::insert_path(std::string_view path, std::string_view full_path,
     }
 }
 
+compiled_tree::compiled_tree(node&& root) {
+    // Size everything up front so the BFS below never reallocates.
+    std::size_t node_count = 0;
+    std::size_t label_bytes = 0;
+    std::size_t entry_count = 0;
+    std::deque<const node*> scan{&root};
+    while (!scan.empty()) {
+        const auto* cur = scan.front();
+        scan.pop_front();
+        ++node_count;
+        label_bytes += cur->path_.size() + cur->indices_.size();
+        if (cur->entry_) {
+            ++entry_count;
+        }
+        for (const auto& child : cur->children_) {
+            scan.push_back(child.get());
+        }
+    }
+
+    nodes_.reserve(node_count);
+    entries_.reserve(entry_count);
+    blob_.reserve(label_bytes);
+
+    // BFS keeps every node's children contiguous, so a child lookup is a single
+    // offset jump from `first_child`.
+    std::deque<node*> pending{&root};
+    nodes_.emplace_back();
+    std::size_t cur_idx = 0;
+    while (!pending.empty()) {
+        auto* src = pending.front();
+        pending.pop_front();
+
+        auto& dst = nodes_[cur_idx++];
+        dst.path_off = static_cast<std::uint32_t>(blob_.size());
+        dst.path_len = static_cast<std::uint16_t>(src->path_.size());
+        blob_ += src->path_;
+        dst.indices_off = static_cast<std::uint32_t>(blob_.size());
+        dst.indices_len = static_cast<std::uint16_t>(src->indices_.size());
+        blob_ += src->indices_;
+        dst.type = src->type_;
+        dst.has_wild_child = src->has_wild_child_;
+
+        if (src->entry_) {
+            dst.entry_idx = static_cast<std::int32_t>(entries_.size());
+            entries_.push_back(std::move(src->entry_));
+        }
+
+        dst.first_child = static_cast<std::uint32_t>(nodes_.size());
+        dst.num_children = static_cast<std::uint16_t>(src->children_.size());
+        for (auto& child : src->children_) {
+            nodes_.emplace_back();
+            pending.push_back(child.get());
+        }
+    }
+}
+
+const route_entry* compiled_tree::locate(std::string_view path, path_params& ps) const {
+    using enum detail::node_type;
+
+    if (nodes_.empty()) {
+        return nullptr;
+    }
+
+    const auto* cur = &nodes_.front();
+    for (;;) {
+        const auto node_path = label_of(*cur);
+        if (path.size() == node_path.size()) {
+            return entry_of(*cur);
+        }
+
+        if (path.size() > node_path.size() && path.starts_with(node_path)) {
+            path.remove_prefix(node_path.size());
+
+            if (!cur->has_wild_child) {
+                const char idxc = path[0];
+                const auto pos = indices_of(*cur).find(idxc);
+                if (pos == std::string_view::npos) {
+                    return nullptr;
+                }
+
+                cur = &nodes_[cur->first_child + pos];
+                continue;
+            }
+
+            const auto& child = nodes_[cur->first_child];
+            if (child.type == param) {
+                const auto param_end = path.find('/');
+                ps.add(label_of(child).substr(1), path.substr(0, param_end));
+
+                if (param_end == std::string_view::npos) {
+                    return entry_of(child);
+                }
+
+                // Go deeper.
+                if (child.num_children > 0) {
+                    path.remove_prefix(param_end);
+                    cur = &nodes_[child.first_child];
+                    continue;
+                }
+            } else if (child.type == catch_all) {
+                ps.add(label_of(child).substr(2), path);
+                return entry_of(child);
+            } else [[unlikely]] {
+                throw std::runtime_error(
+                    fmt::format("node type '{}' of route '{}' is invalid",
+                                esl::to_underlying(child.type), label_of(child)));
+            }
+        }
+
+        return nullptr;
+    }
+}
+
 std::size_t node::increment_child_priority(std::size_t pos) {
     assert(indices_.size() == children_.size());
 
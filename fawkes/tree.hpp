@@ -6,7 +6,7 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -22,11 +22,56 @@
 #include "fawkes/path_params.hpp"
 #include "fawkes/request.hpp"
 #include "fawkes/response.hpp"
+#include "fawkes/small_function.hpp"
+#include "fawkes/swar.hpp"
 
 namespace fawkes {
 
 using route_handler_t =
-    std::function<boost::asio::awaitable<middleware_result>(request&, response&)>;
+    small_function<boost::asio::awaitable<middleware_result>(request&, response&)>;
+
+// The user handler stored as-is for routes without per-route middlewares, letting the
+// dispatcher invoke its awaitable directly with no wrapper coroutine frame in between.
+using direct_handler_t = small_function<boost::asio::awaitable<void>(const request&, response&)>;
+
+// Returns the current entity tag of the resource a conditional route serves; must be
+// cheap relative to the handler, e.g. a version counter or cached digest lookup.
+using etag_validator_t = small_function<std::string(const request&)>;
+
+class ws_session;
+
+// Drives a WebSocket connection after the server completed the handshake; see
+// `server::do_ws()`.
+using ws_handler_t =
+    small_function<boost::asio::awaitable<void>(const request&, ws_session&)>;
+
+// A registered route: the type-erased handler plus per-route dispatch traits.
+// Exactly one of `handler`, `direct` and `ws` is set.
+struct route_entry {
+    route_handler_t handler;
+    direct_handler_t direct;
+
+    // If set, the request body is not buffered before dispatch; the handler consumes it
+    // incrementally through `request::body_reader()`.
+    bool streams_body{false};
+
+    // If set, the server revalidates before dispatch: a matching If-None-Match is
+    // answered with a header-only 304 and the handler never runs.
+    etag_validator_t etag;
+
+    // If set, the route serves WebSocket upgrades: the server completes the handshake
+    // and hands the session over; non-upgrade requests are answered 426.
+    ws_handler_t ws;
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return static_cast<bool>(handler) || static_cast<bool>(direct) ||
+               static_cast<bool>(ws);
+    }
+
+    auto operator()(request& req, response& resp) const {
+        return handler(req, resp);
+    }
+};
 
 namespace detail {
 
@@ -69,55 +114,57 @@ inline constexpr wildcard_result unknown_wildcard;
     return wildcard_result{.name = std::string_view{}, .pos = start};
 }
 
-// Returns length of common prefix.
-[[nodiscard]] constexpr std::size_t longest_common_prefix(std::string_view s1,
-                                                          std::string_view s2) noexcept {
-    auto iters = std::ranges::mismatch(s1, s2);
-    return static_cast<std::size_t>(std::distance(s1.begin(), iters.in1));
-}
+// `longest_common_prefix()` comes from swar.hpp.
+
+enum class node_type : std::uint8_t {
+    plain = 0,
+    root,
+    param,
+    catch_all,
+};
 
 } // namespace detail
 
 class node {
-    enum class type : std::uint8_t {
-        plain = 0,
-        root,
-        param,
-        catch_all,
-    };
+    using type = detail::node_type;
 
 public:
     // Add route path to the node.
     // Throws `std::invalid_argument` if there is path conflict.
-    void add_route(std::string_view path, route_handler_t&& handler) {
+    void add_route(std::string_view path, route_entry&& entry) {
         // The sub-tree rooted by the node has one more route.
         ++priority_;
 
         auto full_path = path;
         if (path_.empty() && indices_.empty()) {
-            insert_path(path, full_path, detail::unknown_wildcard, std::move(handler));
+            insert_path(path, full_path, detail::unknown_wildcard, std::move(entry));
             type_ = type::root;
             return;
         }
 
-        insert_route(path, full_path, std::move(handler));
+        insert_route(path, full_path, std::move(entry));
+    }
+
+    // Throws `std::invalid_argument` if there is path conflict.
+    void add_route(std::string_view path, route_handler_t&& handler) {
+        add_route(path, route_entry{.handler = std::move(handler)});
     }
 
     // Throws `std::runtime_error` if node type is invalid, this is an internal error,
     // and in most cases is caused by implementation bugs.
-    const route_handler_t* locate(std::string_view path, path_params& ps) const;
+    const route_entry* locate(std::string_view path, path_params& ps) const;
 
 private:
     // Find the target node to insert the path.
     // Throws `std::invalid_argument` if there is path conflict.
-    void insert_route(std::string_view path, std::string_view full_path, route_handler_t&& handler);
+    void insert_route(std::string_view path, std::string_view full_path, route_entry&& entry);
 
     // Insert path into the target node.
     // Throws `std::invalid_argument` if there is path conflict.
     void insert_path(std::string_view path,
                      std::string_view full_path,
                      detail::wildcard_result wildcard,
-                     route_handler_t&& handler);
+                     route_entry&& entry);
 
     // Increments priority of the given child and reorders if necessary.
     // `pos` is the index into the child node.
@@ -129,9 +176,61 @@ private:
     type type_{type::plain};
     int priority_{0};
     std::vector<std::unique_ptr<node>> children_;
-    route_handler_t handler_;
+    route_entry entry_;
 
     friend class node_test_inspector;
+    friend class compiled_tree;
+};
+
+// A frozen, read-only form of a radix tree: nodes live in one contiguous array in BFS
+// order with inline edge labels and index-based children, so `locate()` walks offsets
+// instead of chasing per-node heap pointers.
+// Compiling moves the handlers out of the source tree; the tree must not be used
+// afterwards.
+class compiled_tree {
+public:
+    compiled_tree() = default;
+
+    explicit compiled_tree(node&& root);
+
+    [[nodiscard]] bool empty() const noexcept {
+        return nodes_.empty();
+    }
+
+    // Matches the semantics of `node::locate()`.
+    // Throws `std::runtime_error` if node type is invalid, this is an internal error,
+    // and in most cases is caused by implementation bugs.
+    const route_entry* locate(std::string_view path, path_params& ps) const;
+
+private:
+    struct flat_node {
+        std::uint32_t path_off{0};
+        std::uint32_t indices_off{0};
+        std::uint32_t first_child{0};
+        std::int32_t entry_idx{-1};
+        std::uint16_t path_len{0};
+        std::uint16_t indices_len{0};
+        std::uint16_t num_children{0};
+        detail::node_type type{detail::node_type::plain};
+        bool has_wild_child{false};
+    };
+
+    [[nodiscard]] std::string_view label_of(const flat_node& fn) const noexcept {
+        return std::string_view{blob_}.substr(fn.path_off, fn.path_len);
+    }
+
+    [[nodiscard]] std::string_view indices_of(const flat_node& fn) const noexcept {
+        return std::string_view{blob_}.substr(fn.indices_off, fn.indices_len);
+    }
+
+    [[nodiscard]] const route_entry* entry_of(const flat_node& fn) const noexcept {
+        return fn.entry_idx >= 0 ? &entries_[static_cast<std::size_t>(fn.entry_idx)] : nullptr;
+    }
+
+    std::vector<flat_node> nodes_;
+    std::vector<route_entry> entries_;
+    // All edge labels and child indices packed back to back.
+    std::string blob_;
 };
 
 } // namespace fawkes
@@ -33,7 +33,7 @@ public:
 
     int check_priority() const { // NOLINT(modernize-use-nodiscard)
         int prio = 0;
-        if (node_.handler_) {
+        if (node_.entry_) {
             ++prio;
         }
 
@@ -618,6 +618,83 @@ TEST_CASE("Locate wildcard path") {
     }
 }
 
+TEST_CASE("Compiled tree locates like the source tree") {
+    constexpr std::string_view paths[]{
+        "/",
+        "/cmd/:tool/:sub",
+        "/cmd/:tool/",
+        "/src/*filepath",
+        "/search/",
+        "/search/:query",
+        "/user_:name",
+        "/user_:name/about",
+        "/files/:dir/*filepath",
+        "/doc/",
+        "/doc/go_faq.html",
+        "/doc/go1.html",
+        "/info/:user/public",
+        "/info/:user/project/:project",
+    };
+
+    fawkes::node tree;
+    std::string handler_path;
+    for (const auto path : paths) {
+        tree.add_route(path,
+                       [&handler_path, path](const auto&, auto&)
+                           -> asio::awaitable<fawkes::middleware_result> {
+                           handler_path = path;
+                           return []() -> asio::awaitable<fawkes::middleware_result> {
+                               co_return fawkes::middleware_result::proceed;
+                           }();
+                       });
+    }
+
+    const fawkes::compiled_tree compiled(std::move(tree));
+    REQUIRE_FALSE(compiled.empty());
+
+    const locate_request requests[]{
+        {"/", true, "/", {}},
+        {"/cmd/test/", true, "/cmd/:tool/", {{.key = "tool", .value = "test"}}},
+        {"/cmd/test", false, "", {{.key = "tool", .value = "test"}}},
+        {"/cmd/test/3",
+         true,
+         "/cmd/:tool/:sub",
+         {{.key = "tool", .value = "test"}, {.key = "sub", .value = "3"}}},
+        {"/src/some/file.png",
+         true,
+         "/src/*filepath",
+         {{.key = "filepath", .value = "/some/file.png"}}},
+        {"/search/someth!ng+in+ünìcodé",
+         true,
+         "/search/:query",
+         {{.key = "query", .value = "someth!ng+in+ünìcodé"}}},
+        {"/user_test/about", true, "/user_:name/about", {{.key = "name", .value = "test"}}},
+        {"/files/js/inc/framework.js",
+         true,
+         "/files/:dir/*filepath",
+         {{.key = "dir", .value = "js"}, {.key = "filepath", .value = "/inc/framework.js"}}},
+        {"/info/gordon/project/go",
+         true,
+         "/info/:user/project/:project",
+         {{.key = "user", .value = "gordon"}, {.key = "project", .value = "go"}}},
+        {"/no/such/route", false, "", {}},
+    };
+
+    for (const auto& req : requests) {
+        INFO("Test path=", req.test_path);
+        fawkes::path_params params;
+        const auto* handler = compiled.locate(req.test_path, params);
+        CHECK_EQ(req.params, params);
+        CHECK_EQ(handler != nullptr, req.handler_found);
+        if (handler) {
+            fawkes::request fake_req;
+            fawkes::response fake_resp;
+            esl::ignore_unused((*handler)(fake_req, fake_resp));
+            CHECK_EQ(handler_path, req.hit_route);
+        }
+    }
+}
+
 TEST_SUITE_END(); // Router
 
 } // namespace
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#include "fawkes/ws_session.hpp"
+
+#include <system_error>
+
+#include <boost/asio/as_tuple.hpp>
+#include <boost/beast/websocket/error.hpp>
+#include <esl/ignore_unused.h>
+
+namespace fawkes {
+
+asio::awaitable<std::optional<std::string_view>> ws_session::read() {
+#if defined(FAWKES_ENABLE_TLS)
+    if (tls_ws_ != nullptr) {
+        co_return co_await read_from(*tls_ws_);
+    }
+#endif
+    co_return co_await read_from(*ws_);
+}
+
+template<typename Ws>
+asio::awaitable<std::optional<std::string_view>> ws_session::read_from(Ws& ws) {
+    if (closed_) {
+        co_return std::nullopt;
+    }
+
+    buf_.clear();
+    auto [ec, bytes_read] = co_await ws.async_read(buf_, asio::as_tuple);
+    esl::ignore_unused(bytes_read);
+
+    if (ec == websocket::error::closed) {
+        closed_ = true;
+        co_return std::nullopt;
+    }
+    if (ec) {
+        throw std::system_error(ec);
+    }
+
+    got_text_ = ws.got_text();
+    co_return std::string_view{static_cast<const char*>(buf_.cdata().data()),
+                               buf_.cdata().size()};
+}
+
+asio::awaitable<void> ws_session::write_text(std::string_view payload) {
+#if defined(FAWKES_ENABLE_TLS)
+    if (tls_ws_ != nullptr) {
+        co_return co_await write_on(*tls_ws_, asio::buffer(payload), true);
+    }
+#endif
+    co_await write_on(*ws_, asio::buffer(payload), true);
+}
+
+asio::awaitable<void> ws_session::write_binary(asio::const_buffer payload) {
+#if defined(FAWKES_ENABLE_TLS)
+    if (tls_ws_ != nullptr) {
+        co_return co_await write_on(*tls_ws_, payload, false);
+    }
+#endif
+    co_await write_on(*ws_, payload, false);
+}
+
+template<typename Ws>
+asio::awaitable<void> ws_session::write_on(Ws& ws, asio::const_buffer payload, bool text) {
+    ws.text(text);
+    auto [ec, bytes_written] = co_await ws.async_write(payload, asio::as_tuple);
+    esl::ignore_unused(bytes_written);
+    if (ec) {
+        throw std::system_error(ec);
+    }
+}
+
+asio::awaitable<void> ws_session::close() {
+#if defined(FAWKES_ENABLE_TLS)
+    if (tls_ws_ != nullptr) {
+        co_return co_await close_on(*tls_ws_);
+    }
+#endif
+    co_await close_on(*ws_);
+}
+
+template<typename Ws>
+asio::awaitable<void> ws_session::close_on(Ws& ws) {
+    if (closed_) {
+        co_return;
+    }
+    closed_ = true;
+
+    // Best effort: the peer may be gone already.
+    auto [ec] = co_await ws.async_close(websocket::close_code::normal, asio::as_tuple);
+    esl::ignore_unused(ec);
+}
+
+} // namespace fawkes
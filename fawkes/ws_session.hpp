@@ -0,0 +1,96 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/websocket/stream.hpp>
+
+#include "fawkes/tls_stream.hpp"
+
+namespace fawkes {
+
+namespace asio = boost::asio;
+namespace beast = boost::beast;
+namespace websocket = boost::beast::websocket;
+
+// A WebSocket connection after the handshake.
+// Created by the server for routes registered via `server::do_ws()`; the handler drives
+// it until the peer closes or the handler returns. Messages are read into the pooled
+// buffer the connection already rented for HTTP reads, and writes borrow the caller's
+// bytes without copying, so steady-state traffic performs no per-message allocations.
+// Not thread-safe; reads and writes may be interleaved but not run concurrently each.
+class ws_session {
+public:
+    ws_session(websocket::stream<beast::tcp_stream>& ws, beast::flat_buffer& buf)
+        : ws_(&ws),
+          buf_(buf) {}
+
+#if defined(FAWKES_ENABLE_TLS)
+    // Same session over a TLS transport.
+    ws_session(websocket::stream<tls_stream>& ws, beast::flat_buffer& buf)
+        : tls_ws_(&ws),
+          buf_(buf) {}
+#endif
+
+    ~ws_session() = default;
+
+    ws_session(const ws_session&) = delete;
+    ws_session(ws_session&&) = delete;
+    ws_session& operator=(const ws_session&) = delete;
+    ws_session& operator=(ws_session&&) = delete;
+
+    // Reads one complete message and returns a view of its payload, valid until the
+    // next read; returns no value once the peer has closed the connection.
+    // Throws `std::system_error` on read failures.
+    [[nodiscard]] asio::awaitable<std::optional<std::string_view>> read();
+
+    // Whether the last message returned by `read()` was a text frame.
+    [[nodiscard]] bool is_text() const noexcept {
+        return got_text_;
+    }
+
+    // Writes `payload` as one text message; the bytes are borrowed, not copied, and
+    // must stay valid until the awaitable completes.
+    // Throws `std::system_error` on write failures.
+    [[nodiscard]] asio::awaitable<void> write_text(std::string_view payload);
+
+    // Same, as one binary message.
+    [[nodiscard]] asio::awaitable<void> write_binary(asio::const_buffer payload);
+
+    // Sends a normal close frame and waits for the peer's; a no-op once closed.
+    [[nodiscard]] asio::awaitable<void> close();
+
+    [[nodiscard]] bool closed() const noexcept {
+        return closed_;
+    }
+
+private:
+    // The frame path is generic over the transport; only the stream the frames are
+    // exchanged on differs between plaintext and TLS.
+    template<typename Ws>
+    [[nodiscard]] asio::awaitable<std::optional<std::string_view>> read_from(Ws& ws);
+
+    template<typename Ws>
+    [[nodiscard]] asio::awaitable<void> write_on(Ws& ws, asio::const_buffer payload, bool text);
+
+    template<typename Ws>
+    [[nodiscard]] asio::awaitable<void> close_on(Ws& ws);
+
+    websocket::stream<beast::tcp_stream>* ws_{nullptr};
+#if defined(FAWKES_ENABLE_TLS)
+    websocket::stream<tls_stream>* tls_ws_{nullptr};
+#endif
+    beast::flat_buffer& buf_;
+    bool got_text_{false};
+    bool closed_{false};
+};
+
+} // namespace fawkes
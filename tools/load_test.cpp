@@ -0,0 +1,277 @@
+// Copyright (c) 2025 - present, Kingsley Chen. All rights reserved.
+// This file is subject to the terms of license that can be found
+// in the LICENSE file.
+
+// In-process load harness: spins up a fawkes server on the io_thread_pool, hammers it
+// over loopback, and reports throughput plus latency percentiles. Knobs cover the
+// dimensions serve_session() cares about -- connection count, pipelining depth,
+// keep-alive churn and body size -- so macro-level changes get comparable numbers.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/http/string_body.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <boost/beast/http/write.hpp>
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+#include <spdlog/cfg/env.h>
+#include <spdlog/spdlog.h>
+
+#include "fawkes/io_thread_pool.hpp"
+#include "fawkes/request.hpp"
+#include "fawkes/response.hpp"
+#include "fawkes/server.hpp"
+
+namespace asio = boost::asio;
+namespace beast = boost::beast;
+namespace http = boost::beast::http;
+
+DEFINE_uint32(port, 7891, "Loopback port the in-process server listens on");
+DEFINE_uint32(server_threads, 4, "io_thread_pool size of the server under test");
+DEFINE_uint32(connections, 64, "Concurrent client connections");
+DEFINE_uint32(client_threads, 4, "Threads driving the client io_context");
+DEFINE_uint32(duration_secs, 10, "Measurement duration in seconds");
+DEFINE_uint32(pipeline, 1, "Requests written back-to-back before reading responses");
+DEFINE_uint32(close_every, 0,
+              "Close and reconnect after every N requests; 0 keeps connections alive");
+DEFINE_uint32(body_size, 0, "POST body size in bytes; 0 issues bodyless GETs");
+
+namespace {
+
+// HDR-style log-linear histogram over microseconds: 32 linear sub-buckets per power
+// of two, so reported percentiles carry at most ~3% value error.
+class latency_histogram {
+public:
+    static constexpr std::size_t sub_buckets = 32;
+    static constexpr std::size_t num_scales = 32; // Covers beyond an hour.
+
+    void record(std::uint64_t us) noexcept {
+        ++counts_[index_of(us)];
+        ++total_;
+    }
+
+    void merge(const latency_histogram& other) noexcept {
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        total_ += other.total_;
+    }
+
+    [[nodiscard]] std::uint64_t total() const noexcept {
+        return total_;
+    }
+
+    // Representative value below which `pct` percent of samples fall.
+    [[nodiscard]] std::uint64_t value_at(double pct) const noexcept {
+        const auto threshold = static_cast<std::uint64_t>(
+            std::ceil(pct / 100.0 * static_cast<double>(total_)));
+        if (threshold == 0) {
+            return 0;
+        }
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= threshold) {
+                return value_of(i);
+            }
+        }
+        return value_of(counts_.size() - 1);
+    }
+
+private:
+    static std::size_t index_of(std::uint64_t us) noexcept {
+        const auto msb = static_cast<std::size_t>(std::bit_width(us | 1U)) - 1;
+        if (msb < 5) {
+            return us;
+        }
+        const auto shift = std::min(msb - 5, num_scales - 2);
+        return (shift + 1) * sub_buckets + ((us >> shift) & (sub_buckets - 1));
+    }
+
+    static std::uint64_t value_of(std::size_t idx) noexcept {
+        const auto scale = idx / sub_buckets;
+        const auto sub = idx % sub_buckets;
+        return scale == 0 ? sub : (sub_buckets + sub) << (scale - 1);
+    }
+
+    std::array<std::uint64_t, num_scales * sub_buckets> counts_{};
+    std::uint64_t total_{0};
+};
+
+struct run_config {
+    asio::ip::tcp::endpoint endpoint;
+    std::chrono::steady_clock::time_point deadline;
+    std::size_t pipeline{1};
+    std::uint64_t close_every{0};
+    std::string body;
+};
+
+http::request<http::string_body> make_request(const run_config& cfg) {
+    http::request<http::string_body> req;
+    if (cfg.body.empty()) {
+        req.method(http::verb::get);
+        req.target("/ping");
+    } else {
+        req.method(http::verb::post);
+        req.target("/echo");
+        req.body() = cfg.body;
+    }
+    req.version(11);
+    req.set(http::field::host, "127.0.0.1");
+    req.keep_alive(true);
+    req.prepare_payload();
+    return req;
+}
+
+asio::awaitable<void> run_connection(const run_config& cfg,
+                                     latency_histogram& hist,
+                                     std::atomic<std::uint64_t>& completed) {
+    auto executor = co_await asio::this_coro::executor;
+    const auto req = make_request(cfg);
+    std::vector<std::chrono::steady_clock::time_point> sent_at(cfg.pipeline);
+
+    beast::tcp_stream stream(executor);
+    co_await stream.async_connect(cfg.endpoint);
+    beast::flat_buffer buf;
+
+    std::uint64_t sent_on_conn = 0;
+    while (std::chrono::steady_clock::now() < cfg.deadline) {
+        for (std::size_t i = 0; i < cfg.pipeline; ++i) {
+            sent_at[i] = std::chrono::steady_clock::now();
+            co_await http::async_write(stream, req);
+        }
+
+        for (std::size_t i = 0; i < cfg.pipeline; ++i) {
+            http::response<http::string_body> resp;
+            co_await http::async_read(stream, buf, resp);
+            const auto elapsed = std::chrono::steady_clock::now() - sent_at[i];
+            hist.record(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+            completed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        sent_on_conn += cfg.pipeline;
+        if (cfg.close_every > 0 && sent_on_conn >= cfg.close_every) {
+            stream.close();
+            buf.consume(buf.size());
+            co_await stream.async_connect(cfg.endpoint);
+            sent_on_conn = 0;
+        }
+    }
+
+    stream.close();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    spdlog::cfg::load_env_levels();
+
+    try {
+        // The server under test, isolated on its own io threads.
+        asio::io_context server_ioc{1};
+        fawkes::io_thread_pool io_pool(FLAGS_server_threads);
+        fawkes::server server(server_ioc, io_pool);
+
+        server.do_get("/ping",
+                      [](const fawkes::request&, fawkes::response& resp)
+                          -> asio::awaitable<void> {
+                          resp.text(http::status::ok, std::string{"pong"});
+                          co_return;
+                      });
+        server.do_post("/echo",
+                       [](const fawkes::request& req, fawkes::response& resp)
+                           -> asio::awaitable<void> {
+                           resp.text(http::status::ok, std::string{req.body()});
+                           co_return;
+                       });
+
+        const auto port = static_cast<std::uint16_t>(FLAGS_port);
+        server.listen_and_serve("127.0.0.1", port);
+        std::jthread server_thd([&server_ioc] {
+            server_ioc.run();
+        });
+        SPDLOG_INFO("Server under test is listening at {}", port);
+
+        const run_config cfg{
+            .endpoint = {asio::ip::make_address_v4("127.0.0.1"), port},
+            .deadline = std::chrono::steady_clock::now() +
+                        std::chrono::seconds{FLAGS_duration_secs},
+            .pipeline = FLAGS_pipeline > 0 ? FLAGS_pipeline : 1,
+            .close_every = FLAGS_close_every,
+            .body = std::string(FLAGS_body_size, 'x'),
+        };
+
+        asio::io_context client_ioc;
+        std::vector<latency_histogram> hists(FLAGS_connections);
+        std::atomic<std::uint64_t> completed{0};
+        std::atomic<std::uint64_t> failed_connections{0};
+        for (std::uint32_t i = 0; i < FLAGS_connections; ++i) {
+            asio::co_spawn(client_ioc, run_connection(cfg, hists[i], completed),
+                           [&failed_connections](std::exception_ptr eptr) {
+                               if (eptr) {
+                                   failed_connections.fetch_add(1,
+                                                                std::memory_order_relaxed);
+                               }
+                           });
+        }
+
+        const auto started_at = std::chrono::steady_clock::now();
+        {
+            std::vector<std::jthread> client_thds;
+            client_thds.reserve(FLAGS_client_threads);
+            for (std::uint32_t i = 0; i < FLAGS_client_threads; ++i) {
+                client_thds.emplace_back([&client_ioc] {
+                    client_ioc.run();
+                });
+            }
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - started_at);
+
+        server.stop();
+
+        latency_histogram merged;
+        for (const auto& hist : hists) {
+            merged.merge(hist);
+        }
+
+        fmt::print("connections={} pipeline={} close_every={} body_size={}\n",
+                   FLAGS_connections, cfg.pipeline, cfg.close_every, FLAGS_body_size);
+        fmt::print("requests={} failed_connections={} elapsed={:.2f}s throughput={:.0f} req/s\n",
+                   completed.load(), failed_connections.load(), elapsed.count(),
+                   static_cast<double>(completed.load()) / elapsed.count());
+        fmt::print("latency p50={}us p90={}us p99={}us p999={}us\n",
+                   merged.value_at(50.0), merged.value_at(90.0), merged.value_at(99.0),
+                   merged.value_at(99.9));
+    } catch (const std::exception& ex) {
+        SPDLOG_ERROR("Unexpected error: {}", ex.what());
+        return 1;
+    }
+
+    return 0;
+}